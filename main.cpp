@@ -1,37 +1,284 @@
-#include <bitset>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <condition_variable>
+#include <cstring>
+#include <ctime>
+#include <deque>
 #include <fstream>
+#include <functional>
+#include <iomanip>
 #include <iostream>
-#include <iterator>
 #include <map>
+#include <mutex>
 #include <queue>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <csignal>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#ifdef __linux__
+#include <linux/io_uring.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#else
+// io_uring is Linux only, everywhere else the pipeline uses pread and pwrite
+enum { IORING_OP_READ_FIXED, IORING_OP_WRITE };
+#endif
 
 typedef unsigned char Byte;
 
+// The hot kernels are compiled once more for every x86-64 level, flattened so
+// everything they call is compiled for it too, see IsaKernels
+#if defined(__x86_64__) && defined(__GNUC__)
+#define TARGET_X86_64_V2 __attribute__((target("arch=x86-64-v2"), flatten))
+#define TARGET_X86_64_V3 __attribute__((target("arch=x86-64-v3"), flatten))
+#define TARGET_X86_64_V4 __attribute__((target("arch=x86-64-v4"), flatten))
+#else
+#define TARGET_X86_64_V2
+#define TARGET_X86_64_V3
+#define TARGET_X86_64_V4
+#endif
+
 // Constants
 
-const char PADDING_BIT = '0';
-const char LEFT_CHAR = '0';
-const char RIGHT_CHAR = '1';
 const char NULL_CHAR = '\0';
 std::string COMPRESSED_FILE_EXTENSION;
+// Set by --serve, errors then only fail the request, see exit_with_error
+bool SERVING = false;
+
+// Instruction sets the hot kernels are compiled for. The best one the CPU
+// supports up to ISA_DEFAULT_MAX is picked at startup, HUFFMAN_ISA can pick
+// any supported one by name. ISA_BASELINE is whatever the binary was built for
+enum Isa {
+  ISA_BASELINE,
+  ISA_X86_64_V2,
+  ISA_X86_64_V3,
+  ISA_X86_64_V4,
+  ISA_COUNT
+};
+const char *const ISA_NAMES[ISA_COUNT] = {"baseline", "x86-64-v2", "x86-64-v3",
+                                          "x86-64-v4"};
+// AVX-512 shuffles slower than AVX2 and is no faster elsewhere
+const Isa ISA_DEFAULT_MAX = ISA_X86_64_V3;
+
+// Input is split into blocks whose size depends on the compression level, each
+// block gets its own table and falls back to being stored raw when coding would
+// not shrink it. Type 0 held symbol counts and a bit string of tree codes up to
+// format version 2, it is no longer written and reading rejects it
+const Byte BLOCK_HUFFMAN = 0;
+const Byte BLOCK_STORED = 1;
+const Byte BLOCK_RANS = 2;
+
+// Files start with FILE_MAGIC, the format version and the original file size.
+// The version changes whenever the layout of a block type changes, so older
+// files are reported instead of decoded into garbage. New block types keep it,
+// older releases reject them as unknown. Files from before the magic held a
+// single Huffman coded stream and are reported as well
+const Byte FILE_MAGIC[] = {'H', 'U', 'F', 'F'};
+const Byte FORMAT_VERSION = 4;
+const uint32_t FILE_HEADER_SIZE =
+    sizeof(FILE_MAGIC) + sizeof(Byte) + sizeof(uint32_t);
+// block type, raw size and payload size, the payload being the table and data
+// that follow the header
+const uint32_t BLOCK_HEADER_SIZE = sizeof(Byte) + 2 * sizeof(uint32_t);
+// rANS blocks store the frequencies normalized to sum to RANS_SCALE, a 16 bit
+// symbol count then a (Byte, uint16_t) pair per symbol
+const uint32_t RANS_SCALE_BITS = 12;
+const uint32_t RANS_SCALE = 1 << RANS_SCALE_BITS;
+const uint32_t RANS_SYMBOLS_SIZE_FIELD = sizeof(uint16_t);
+const uint32_t RANS_FREQUENCY_ENTRY_SIZE = sizeof(Byte) + sizeof(uint16_t);
+// Symbols are spread over this many interleaved 32 bit states kept in
+// [RANS_LOWER_BOUND, RANS_LOWER_BOUND << 8), all flushed at the end of the
+// encoded stream
+const uint32_t RANS_STATES = 4;
+const uint32_t RANS_LOWER_BOUND = 1 << 23;
+// The entropy gives the size of a rANS stream to within a fraction of a
+// percent, only streams it puts within 1/2^RANS_ENTROPY_MARGIN_SHIFT of the
+// best size so far have their exact size worked out
+const uint32_t RANS_ENTROPY_MARGIN_SHIFT = 8;
+// Word blocks code bytes as symbols 0-255 and the tokens of their vocabulary
+// from WORD_FIRST_SYMBOL on. Only tokens seen WORD_MIN_COUNT times make it
+// into the vocabulary, every other token is coded as its bytes
+const Byte BLOCK_WORDS = 3;
+const uint32_t WORD_FIRST_SYMBOL = UCHAR_MAX + 1;
+const uint32_t WORD_MIN_COUNT = 2;
+const uint32_t WORD_MAX_LENGTH = UCHAR_MAX;
+const uint32_t WORD_VOCABULARY_LIMIT = (1 << 16) - WORD_FIRST_SYMBOL;
+// vocabulary size, then every token front coded as the length it shares with
+// the one before it, its remaining length and remaining bytes, then the
+// canonical code lengths of all symbols, listed or packed after a byte that
+// says which like the table byte of canonical blocks
+const uint32_t VOCABULARY_SIZE_FIELD = sizeof(uint32_t);
+const uint32_t WORD_LENGTHS_FORM_FIELD = sizeof(Byte);
+// Canonical blocks code symbols of a configurable width with length limited
+// canonical Huffman codes, decoded through a table indexed by the next
+// MIN_DECODE_TABLE_BITS to DECODE_TABLE_BITS bits, as many as the longest code
+// needs, and second level tables for longer codes
+const Byte BLOCK_CANONICAL = 4;
+const uint32_t MAX_CODE_LENGTH = 20;
+const uint32_t MIN_DECODE_TABLE_BITS = 9;
+const uint32_t DECODE_TABLE_BITS = 11;
+// One decode kernel per table size, plus one for tables with second level
+// tables
+const uint32_t DECODE_KERNEL_VARIANTS =
+    DECODE_TABLE_BITS - MIN_DECODE_TABLE_BITS + 2;
+// Large blocks of bytes whose codes average at most MULTI_DECODE_MAX_LENGTH
+// bits decode through a table indexed by the next MULTI_DECODE_TABLE_BITS
+// bits, whose entries hold all whole codes in them, up to MULTI_DECODE_SYMBOLS
+const uint32_t MULTI_DECODE_TABLE_BITS = 12;
+const uint32_t MULTI_DECODE_SYMBOLS = 4;
+const uint32_t MULTI_DECODE_MAX_LENGTH = 6;
+const uint32_t MULTI_DECODE_MIN_SIZE = 1 << 15;
+// symbol width, with SYMBOLS_PAIRS a 16 bit pair count and the pairs, then a
+// 32 bit symbol count and a (uint16_t symbol, Byte length) pair per symbol
+const uint32_t SYMBOL_WIDTH_FIELD = sizeof(Byte);
+const uint32_t PAIRS_SIZE_FIELD = sizeof(uint16_t);
+const uint32_t LENGTHS_SIZE_FIELD = sizeof(uint32_t);
+const uint32_t CODE_LENGTH_ENTRY_SIZE = sizeof(uint16_t) + sizeof(Byte);
+// The high bits of the symbol width say where the code lengths come from.
+// Inside split and filtered blocks a canonical block can reuse one of the
+// TABLE_CACHE_SIZE most recently used tables, or store the symbols whose
+// lengths differ from it as a length table, 0 for symbols that no longer
+// occur. Both give the index of the table in the next byte.
+const Byte TABLE_STORED = 0x00;
+const Byte TABLE_REUSED = 0x10;
+const Byte TABLE_DELTA = 0x20;
+const Byte TABLE_MODE_MASK = 0xf0;
+const uint32_t TABLE_INDEX_FIELD = sizeof(Byte);
+const uint32_t TABLE_CACHE_SIZE = 4;
+// A block's own lengths can also be TABLE_PACKED when that is smaller: the
+// code length of each length symbol in LENGTH_CODE_BITS bits, then the coded
+// length of every symbol, padded to a byte. Length symbols past
+// MAX_CODE_LENGTH repeat the previous length or stand for a run of zeros,
+// LENGTH_RUN_MIN plus LENGTH_RUN_EXTRA_BITS extra bits long
+const Byte TABLE_PACKED = 0x30;
+const uint32_t LENGTH_REPEAT = MAX_CODE_LENGTH + 1;
+const uint32_t LENGTH_ZEROS = MAX_CODE_LENGTH + 2;
+const uint32_t LENGTH_ZEROS_LONG = MAX_CODE_LENGTH + 3;
+const uint32_t LENGTH_ZEROS_HUGE = MAX_CODE_LENGTH + 4;
+const uint32_t LENGTH_ALPHABET_SIZE = MAX_CODE_LENGTH + 5;
+const uint32_t LENGTH_RUN_MIN[] = {3, 3, 11, 139};
+const uint32_t LENGTH_RUN_EXTRA_BITS[] = {2, 3, 7, 16};
+const uint32_t LENGTH_CODE_BITS = 3;
+const uint32_t MAX_LENGTH_CODE_LENGTH = (1 << LENGTH_CODE_BITS) - 1;
+// Byte blocks of at most STATIC_MAX_SIZE bytes can instead name one of the
+// built-in tables with TABLE_BUILTIN, its index and its id, a hash of its code
+// lengths, so a binary with retrained tables refuses to decode them.
+// --generate-tables trains them on text, JSON and binary files into
+// static_tables.h, with a code of at most STATIC_MAX_CODE_LENGTH bits for
+// every byte
+const Byte TABLE_BUILTIN = 0x40;
+const uint32_t STATIC_TABLE_ID_FIELD = sizeof(uint32_t);
+const uint32_t STATIC_MAX_SIZE = 4 << 10;
+const uint32_t STATIC_MAX_CODE_LENGTH = 15;
+enum StaticTable : Byte {
+  STATIC_TEXT,
+  STATIC_JSON,
+  STATIC_BINARY,
+  STATIC_TABLES
+};
+// At most this many byte pairs become symbols after the 256 bytes, each seen
+// at least PAIR_MIN_COUNT times
+const uint32_t PAIR_LIMIT = 256;
+const uint32_t PAIR_MIN_COUNT = 64;
+const uint16_t NO_PAIR = UINT16_MAX;
+// With SYMBOLS_RUNS a byte repeated RUN_MIN_REPEAT or more times after itself
+// is coded as the byte then a run symbol. Run symbol k follows the bytes and
+// is followed by k extra bits, together they give repeats - RUN_MIN_REPEAT + 1
+// as 1 then the extra bits. Blocks count runs only when they cover at least
+// 1 / RUN_MIN_SHARE of the block
+const uint32_t RUN_MIN_REPEAT = 4;
+const uint32_t RUN_SYMBOLS = 24;
+const uint32_t RUN_MIN_SHARE = 64;
+// Filtered blocks hold the filter, its element width, then whole blocks which
+// are never filtered themselves, together holding the filtered data
+const Byte BLOCK_FILTERED = 6;
+const Byte FILTER_NONE = 0;
+const Byte FILTER_DELTA = 1;
+const Byte FILTER_SHUFFLE = 2;
+const uint32_t FILTER_HEADER_SIZE = 2 * sizeof(Byte);
+// Blocks are split at multiples of this when their statistics change, the
+// parts follow each other in a split block
+const Byte BLOCK_SPLIT = 7;
+const uint32_t SPLIT_CHUNK_SIZE = 16 << 10;
+const uint32_t N_LOG2_N_TABLE_SIZE = SPLIT_CHUNK_SIZE + 1;
+// BWT blocks hold the Burrows-Wheeler transform of the block, move to front
+// coded with zero runs written in bijective base 2 as RUNA and RUNB digits,
+// and every other index n as symbol n + 1. The rows of BWT_STREAMS evenly
+// spaced text positions, then code lengths as in canonical blocks, then the
+// code bits
+const Byte BLOCK_BWT = 5;
+const uint16_t RUNA = 0;
+const uint16_t RUNB = 1;
+const uint32_t BWT_ALPHABET_SIZE = UCHAR_MAX + 2;
+// The inverse transform walks this many parts of the block at once so their
+// cache misses overlap
+const uint32_t BWT_STREAMS = 8;
+const uint32_t START_ROWS_SIZE = BWT_STREAMS * sizeof(uint32_t);
+// The inverse transform packs a position and a byte into 32 bits
+const uint32_t BWT_MAX_BLOCK_SIZE = 1 << 24;
+
+// A sampled estimate looks at about this many evenly spaced blocks, files
+// larger than ESTIMATE_EXACT_LIMIT are always sampled
+const uint32_t ESTIMATE_SAMPLE_BLOCKS = 64;
+const uint64_t ESTIMATE_EXACT_LIMIT = uint64_t(1) << 30;
+
+// A sample whose byte entropy is above this many bits is taken to mean the
+// whole block is incompressible, the sample is read in this many chunks spread
+// over the block
+const double INCOMPRESSIBLE_ENTROPY = 7.7;
+const uint32_t SAMPLE_CHUNKS = 16;
+
+// Large histograms are also counted by the threads the pipeline leaves idle,
+// which claim HISTOGRAM_CHUNK_SIZE bytes at a time. A thread is only started
+// for every HISTOGRAM_THREAD_MIN_SIZE bytes, counting which takes over 10 times
+// as long as starting it. Each thread counts into its own CACHE_LINE_SIZE
+// aligned array
+const uint32_t HISTOGRAM_THREAD_MIN_SIZE = 2 << 20;
+const uint32_t HISTOGRAM_CHUNK_SIZE = 1 << 20;
+const size_t CACHE_LINE_SIZE = 64;
+
+const int MIN_LEVEL = 1;
+const int MAX_LEVEL = 9;
+const int DEFAULT_LEVEL = 6;
 
 // Structs
 
+// Symbols are bytes, or word symbols in BLOCK_WORDS blocks
 struct HuffmanNode {
-  Byte byte;
+  uint32_t symbol;
   uint32_t freq;
   HuffmanNode *left, *right;
 
   HuffmanNode() = default;
 
-  HuffmanNode(Byte _byte, uint32_t _freq, HuffmanNode *_left = nullptr,
+  HuffmanNode(uint32_t _symbol, uint32_t _freq, HuffmanNode *_left = nullptr,
               HuffmanNode *_right = nullptr)
-      : byte{_byte}, freq{_freq}, left{_left}, right{_right} {}
+      : symbol{_symbol}, freq{_freq}, left{_left}, right{_right} {}
 
   HuffmanNode(HuffmanNode *_left, HuffmanNode *_right)
-      : byte{NULL_CHAR}, freq{_left->freq + _right->freq}, left{_left},
+      : symbol{NULL_CHAR}, freq{_left->freq + _right->freq}, left{_left},
         right{_right} {}
 };
 
@@ -39,11 +286,490 @@ struct greater_frequency {
   bool operator()(HuffmanNode *l, HuffmanNode *r) { return l->freq > r->freq; }
 };
 
+struct Block {
+  Byte type;
+  uint32_t raw_size;
+  // Symbol counts while a block is planned, normalized frequencies for
+  // BLOCK_RANS
+  std::map<Byte, uint32_t> frequencies;
+  // Only used by BLOCK_WORDS, the sorted vocabulary
+  std::vector<std::string> vocabulary;
+  // Only used by BLOCK_CANONICAL, BLOCK_WORDS and BLOCK_BWT, the code length
+  // of every symbol of the alphabet, 0 for the ones that do not occur
+  Byte symbol_width;
+  std::vector<std::pair<Byte, Byte>> pairs;
+  std::vector<Byte> code_lengths;
+  // Only used by BLOCK_CANONICAL, with TABLE_REUSED and TABLE_DELTA the
+  // recent table the lengths refer to, and the lengths that differ from it
+  Byte table_mode = TABLE_STORED;
+  Byte table_index = 0;
+  std::vector<std::pair<uint16_t, Byte>> length_changes;
+  // Only used with TABLE_BUILTIN, the id of the table the block was coded with
+  uint32_t table_id = 0;
+  // Only used by BLOCK_BWT, the rows of the sorted rotations starting at
+  // every stream, the first one holds the whole block
+  uint32_t start_rows[BWT_STREAMS];
+  // Only used by BLOCK_FILTERED, whose data are the serialized inner blocks
+  Byte filter;
+  Byte filter_width;
+  // Code bits for blocks with a code, the rANS stream for BLOCK_RANS, the raw
+  // bytes for BLOCK_STORED
+  std::vector<Byte> data;
+};
+
+// CODER_AUTO codes every block with whichever of Huffman and rANS makes it
+// smaller, CODER_WORDS with word or byte Huffman, CODER_BWT also tries
+// Huffman after a Burrows-Wheeler transform on top of CODER_AUTO
+enum Coder { CODER_HUFFMAN, CODER_RANS, CODER_AUTO, CODER_WORDS, CODER_BWT };
+
+// Symbols Huffman codes are built over. Wider symbols are only used for a
+// block when they make it smaller than bytes do
+enum SymbolWidth {
+  SYMBOLS_8,
+  // Little endian 16 bit values, for UTF-16 text and 16 bit samples
+  SYMBOLS_16,
+  // Bytes plus the most frequent byte pairs of the block
+  SYMBOLS_PAIRS,
+  // Bytes plus run lengths, tried on every block with long runs
+  SYMBOLS_RUNS
+};
+
+// Everything a compression level decides
+struct CompressionLevel {
+  uint32_t block_size;
+  // Bytes sampled before histogramming a block, blocks whose sample looks
+  // incompressible are stored right away. 0 histograms every block
+  uint32_t sample_size;
+  Coder coder;
+  SymbolWidth symbols;
+  // Split blocks where the byte statistics change, see split_block
+  bool split;
+  // Blocks up to this size are coded with the best built-in table without
+  // counting or building anything, larger levels only weigh the built-in
+  // tables against a block's own
+  uint32_t static_size;
+  // Tables cached in a split or filtered block that a part is tried against,
+  // up to TABLE_CACHE_SIZE, see choose_table
+  uint32_t reuse_tables;
+  // Codes over MAX_CODE_LENGTH are limited with package-merge, which gives
+  // the smallest limited code, instead of by clamping the Huffman tree
+  bool optimal_lengths;
+  // Only set with --filter, delta is used for blocks it lowers the byte
+  // entropy of, shuffle for every block that does not end up stored
+  Byte filter = FILTER_NONE;
+  Byte filter_width = 0;
+  // Threads a block's histogram may use, set from the threads the pipeline
+  // leaves idle when there are fewer blocks than threads
+  unsigned histogram_threads = 1;
+};
+
+// Indexed by level, see the README for measured speed and ratio
+const CompressionLevel COMPRESSION_LEVELS[MAX_LEVEL + 1] = {
+    {0, 0, CODER_HUFFMAN, SYMBOLS_8, false, 0, 0, false}, // unused
+    {1 << 20, 4 << 10, CODER_HUFFMAN, SYMBOLS_8, false, STATIC_MAX_SIZE, 0,
+     false}, // 1
+    {1 << 20, 8 << 10, CODER_HUFFMAN, SYMBOLS_8, false, STATIC_MAX_SIZE, 0,
+     false},
+    {1 << 20, 16 << 10, CODER_HUFFMAN, SYMBOLS_8, false, STATIC_MAX_SIZE, 1,
+     false},
+    {1 << 20, 32 << 10, CODER_HUFFMAN, SYMBOLS_8, true, 0, 2, false},
+    {1 << 20, 64 << 10, CODER_HUFFMAN, SYMBOLS_8, true, 0, 4, false},
+    {1 << 20, 0, CODER_HUFFMAN, SYMBOLS_8, true, 0, 4, false}, // 6
+    {2 << 20, 0, CODER_AUTO, SYMBOLS_8, true, 0, 4, true},
+    {4 << 20, 0, CODER_AUTO, SYMBOLS_PAIRS, true, 0, 4, true},
+    {8 << 20, 0, CODER_BWT, SYMBOLS_PAIRS, false, 0, 4, true}, // 9
+};
+
+// --memory-limit covers MEMORY_BASE for the process itself, every block in
+// flight with its output, and the working memory of every worker. That is
+// per byte of the block it compresses, by coder, measured peaks with
+// headroom, plus FILTER_MEMORY_FACTOR for filtered blocks. Blocks are halved
+// down to MIN_MEMORY_BLOCK_SIZE when fewer workers are not enough
+const uint64_t MEMORY_BASE = 8 << 20;
+const uint32_t COMPRESS_MEMORY_FACTORS[CODER_BWT + 1] = {4, 4, 4, 8, 24};
+const uint32_t FILTER_MEMORY_FACTOR = 2;
+const uint32_t MIN_MEMORY_BLOCK_SIZE = 64 << 10;
+// Decoding takes the payload and output of a block, and
+// BWT_DECODE_MEMORY_FACTOR bytes per output byte for blocks that are or may
+// hold BWT blocks
+const uint32_t BWT_DECODE_MEMORY_FACTOR = 6;
+
+// --serve requests are an operation, a level, 0 for the server's own, and a
+// 64 bit size followed by that many bytes of input. With SERVE_FDS set in the
+// operation, an input and an output file descriptor come along instead and
+// the size is 0. Responses are a status and a 64 bit size followed by the
+// output, which with SERVE_FDS went to the output file descriptor instead, or
+// by the error message
+const Byte SERVE_COMPRESS = 0;
+const Byte SERVE_DECOMPRESS = 1;
+const Byte SERVE_FDS = 0x80;
+const Byte SERVE_OK = 0;
+const Byte SERVE_FAILED = 1;
+const uint32_t SERVE_REQUEST_HEADER_SIZE = 2 * sizeof(Byte) + sizeof(uint64_t);
+// Inline input is limited to this, or to --memory-limit when that is lower,
+// larger inputs go through file descriptors
+const uint64_t SERVE_MAX_INLINE_SIZE = 1 << 30;
+
+// Pipeline stages timed for --stats
+enum Stage {
+  STAGE_READ,
+  STAGE_TRANSFORM,
+  STAGE_HISTOGRAM,
+  STAGE_TREE,
+  STAGE_TABLE,
+  STAGE_ENCODE,
+  STAGE_DECODE,
+  STAGE_WRITE,
+  STAGE_COUNT
+};
+
+const char *const STAGE_NAMES[STAGE_COUNT] = {
+    "read", "transform", "histogram", "tree", "table", "encode", "decode", "write"};
+
+// Hardware counters read around every stage with --perf, opened as one
+// perf_event_open group per thread so they are scheduled together
+enum PerfCounter {
+  PERF_CYCLES,
+  PERF_INSTRUCTIONS,
+  PERF_BRANCH_MISSES,
+  PERF_L1D_MISSES,
+  PERF_LLC_MISSES,
+  PERF_COUNTER_COUNT
+};
+
+const char *const PERF_COUNTER_NAMES[PERF_COUNTER_COUNT] = {
+    "cycles", "instructions", "branch_misses", "l1d_misses", "llc_misses"};
+
+// Atomic so blocks can be timed from several threads
+struct StageStats {
+  std::atomic<uint64_t> wall_ns{0};
+  std::atomic<uint64_t> cpu_ns{0};
+  std::atomic<uint64_t> bytes{0};
+  std::atomic<uint64_t> perf[PERF_COUNTER_COUNT] = {};
+};
+
+struct Stats {
+  StageStats stages[STAGE_COUNT];
+  std::atomic<uint32_t> blocks{0};
+  uint64_t bytes_in = 0;
+  uint64_t bytes_out = 0;
+  uint32_t threads = 1;
+  // Wall and process CPU clocks when the current file was started
+  uint64_t start_wall_ns = 0;
+  uint64_t start_cpu_ns = 0;
+  // Set by --perf, perf_errno is the error of the first counter group that
+  // could not be opened
+  bool perf = false;
+  std::atomic<int> perf_errno{0};
+};
+
+Stats STATS;
+
+uint64_t wall_clock_ns();
+uint64_t thread_cpu_ns();
+bool read_perf_counters(uint64_t values[PERF_COUNTER_COUNT]);
+
+// Adds the wall and CPU time, and the hardware counters with --perf, of its
+// scope to a stage
+struct StageTimer {
+  Stage stage;
+  uint64_t bytes;
+  uint64_t start_wall_ns, start_cpu_ns;
+  uint64_t start_perf[PERF_COUNTER_COUNT];
+  bool perf;
+
+  StageTimer(Stage _stage, uint64_t _bytes = 0)
+      : stage{_stage}, bytes{_bytes},
+        perf{STATS.perf && read_perf_counters(start_perf)} {
+    start_wall_ns = wall_clock_ns();
+    start_cpu_ns = thread_cpu_ns();
+  }
+
+  ~StageTimer() {
+    StageStats &stats = STATS.stages[stage];
+    stats.wall_ns += wall_clock_ns() - start_wall_ns;
+    stats.cpu_ns += thread_cpu_ns() - start_cpu_ns;
+    stats.bytes += bytes;
+
+    uint64_t end_perf[PERF_COUNTER_COUNT];
+    if (perf && read_perf_counters(end_perf)) {
+      for (int i = 0; i < PERF_COUNTER_COUNT; ++i) {
+        stats.perf[i] += end_perf[i] - start_perf[i];
+      }
+    }
+  }
+};
+
+enum IoBackend { IO_AUTO, IO_URING, IO_PREAD };
+// --threads is clamped to this many threads per hardware thread, more would
+// only contend for the same cores
+const unsigned MAX_THREADS_PER_CPU = 4;
+
+// Thrown by exit_with_error while serving, so a bad request only fails itself
+struct RequestError : std::runtime_error {
+  using std::runtime_error::runtime_error;
+};
+
+struct Options {
+  bool decompress = false;
+  int level = DEFAULT_LEVEL;
+  // IO_AUTO uses io_uring where the kernel supports it
+  IoBackend io = IO_AUTO;
+  unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+  bool stats = false;
+  bool stats_json = false;
+  bool estimate = false;
+  // Also report every block when estimating
+  bool estimate_blocks = false;
+  // Estimate from evenly spaced sample blocks instead of the whole file
+  bool sample = false;
+  // Override the coder and symbol width of the level when set with --coder
+  // and --symbols
+  int coder = -1;
+  int symbols = -1;
+  // Set with --filter=delta:N or --filter=shuffle:N
+  Byte filter = FILTER_NONE;
+  Byte filter_width = 0;
+  // Train the built-in tables instead of compressing
+  bool generate_tables = false;
+  // Set with --memory-limit=N[K|M|G], 0 leaves memory unbounded
+  uint64_t memory_limit = 0;
+  // Serve requests on a Unix socket instead of compressing
+  bool serve = false;
+};
+
+struct SizeEstimate {
+  uint64_t original_size = 0;
+  uint64_t compressed_size = 0;
+  // Shannon entropy of the byte histogram, in bits per byte
+  double entropy = 0;
+  // Type the block would be written as, only meaningful for a single block
+  Byte type = BLOCK_CANONICAL;
+  uint32_t blocks = 0;
+  // Blocks that were actually histogrammed, less than blocks when sampled
+  uint32_t sampled_blocks = 0;
+  // Position of a single block in its file
+  uint32_t block = 0;
+};
+
+// A block split into word tokens, with the canonical code over its symbols
+struct WordModel {
+  std::vector<std::string> vocabulary;
+  std::vector<uint32_t> symbols;
+  std::vector<uint32_t> counts;
+  std::vector<Byte> code_lengths;
+};
+
+// One entry of a canonical decode table. Entries of codes longer than the
+// table index point to a second level table of 2^subtable_bits entries at
+// value, all others hold the symbol and the full code length
+struct DecodeEntry {
+  uint32_t value;
+  Byte length;
+  Byte subtable_bits;
+};
+
+// Decodes a canonical block into the range, see decode_symbols
+typedef void (*DecodeKernel)(const Block &block, const DecodeEntry *table,
+                             Byte *begin, Byte *end);
+
+// Decodes a word block into the range, vocabulary token i is the bytes from
+// token_starts[i] to token_starts[i + 1] of token_bytes, see
+// decode_word_symbols
+typedef void (*WordDecodeKernel)(const Block &block, const DecodeEntry *table,
+                                 const uint32_t *token_starts,
+                                 const Byte *token_bytes, Byte *begin,
+                                 Byte *end);
+
+// One entry of a multi symbol decode table, the bytes of the whole codes in
+// its index and their total length. Entries whose first code is longer than
+// the index hold no symbols, those go through the canonical decode table
+struct MultiDecodeEntry {
+  Byte symbols[MULTI_DECODE_SYMBOLS];
+  Byte count;
+  Byte length;
+};
+
+// Decodes a canonical block of bytes into the range, see decode_multi_symbols
+typedef void (*MultiDecodeKernel)(const Block &block, const DecodeEntry *table,
+                                  const MultiDecodeEntry *multi_table,
+                                  Byte *begin, Byte *end);
+
+// A table later canonical blocks of a split or filtered block can refer to.
+// Only the decoder fills in the decode table, so reusing a table costs it no
+// rebuild
+struct CachedTable {
+  Byte symbol_width;
+  std::vector<Byte> code_lengths;
+  std::vector<DecodeEntry> decode_table;
+};
+
+// Most recently used first, at most TABLE_CACHE_SIZE tables
+typedef std::deque<CachedTable> TableCache;
+
+// A built-in table with the codes for the encoder and the decode table, all
+// compiled in as read only data
+struct BuiltinTable {
+  const Byte *code_lengths;
+  const uint32_t *codes;
+  const DecodeEntry *decode_table;
+  size_t decode_table_size;
+  uint32_t id;
+};
+
+// Generated, defines STATIC_CODE_LENGTHS and BUILTIN_TABLES
+#include "static_tables.h"
+
+// Packs codes most significant bit first, flush pads the last byte with
+// zeros
+struct BitWriter {
+  std::vector<Byte> bytes;
+  uint64_t buffer = 0;
+  uint32_t buffered_bits = 0;
+
+  void put(uint32_t code, uint32_t length) {
+    buffer = buffer << length | code;
+    buffered_bits += length;
+    while (buffered_bits >= CHAR_BIT) {
+      buffered_bits -= CHAR_BIT;
+      bytes.push_back(Byte(buffer >> buffered_bits));
+    }
+  }
+
+  void flush() {
+    if (buffered_bits)
+      bytes.push_back(Byte(buffer << (CHAR_BIT - buffered_bits)));
+    buffered_bits = 0;
+  }
+};
+
+// The variants of a hot kernel for every instruction set, see ISA_KERNEL
+template <typename Kernel, Kernel Function> struct IsaKernels;
+template <typename Result, typename... Args, Result (*Kernel)(Args...)>
+struct IsaKernels<Result (*)(Args...), Kernel> {
+  TARGET_X86_64_V2 static Result x86_64_v2(Args... args) {
+    return Kernel(args...);
+  }
+  TARGET_X86_64_V3 static Result x86_64_v3(Args... args) {
+    return Kernel(args...);
+  }
+  TARGET_X86_64_V4 static Result x86_64_v4(Args... args) {
+    return Kernel(args...);
+  }
+};
+
+// Keeps the next bits at the top of buffer, a corrupt block reads zeros past
+// the end of its data
+struct BitReader {
+  const Byte *cursor, *end;
+  uint64_t buffer = 0;
+  uint32_t buffered_bits = 0;
+
+  BitReader(const std::vector<Byte> &bytes)
+      : cursor{bytes.data()}, end{bytes.data() + bytes.size()} {}
+  BitReader(const Byte *begin, const Byte *limit)
+      : cursor{begin}, end{limit} {}
+
+  // Leaves at least 57 bits in the buffer
+  void refill() {
+    while (buffered_bits <= 56) {
+      buffer |= uint64_t(cursor < end ? *cursor++ : 0) << (56 - buffered_bits);
+      buffered_bits += CHAR_BIT;
+    }
+  }
+
+  void consume(uint32_t bits) {
+    buffer <<= bits;
+    buffered_bits -= bits;
+  }
+};
+
+// A range of the input file that is handled as one block
+struct Extent {
+  uint64_t offset;
+  uint32_t length;
+};
+
+// The submission and completion rings of an io_uring instance, mapped from
+// the kernel
+struct IoRing {
+  int fd = -1;
+#ifdef __linux__
+  void *sq_ring = nullptr, *cq_ring = nullptr;
+  size_t sq_ring_size = 0, cq_ring_size = 0, sqes_size = 0;
+  unsigned *sq_head, *sq_tail, *sq_mask, *sq_array;
+  unsigned *cq_head, *cq_tail, *cq_mask;
+  io_uring_sqe *sqes = nullptr;
+  io_uring_cqe *cqes = nullptr;
+  unsigned sq_entries = 0;
+#endif
+  // Queued entries the kernel has not been told about yet
+  unsigned unsubmitted = 0;
+};
+
+typedef std::function<std::vector<Byte>(const std::vector<Byte> &)>
+    BlockTransform;
+
+// Block size, worker count and blocks in flight of a pipeline, see
+// plan_pipeline
+struct PipelinePlan {
+  uint32_t block_size;
+  unsigned workers;
+  size_t depth;
+};
+
+struct PipelineJob {
+  uint32_t index = 0;
+  // Input buffer the block was read into
+  int buffer = -1;
+  std::vector<Byte> output{};
+  uint64_t out_offset = 0;
+};
+
+// Blocks flow from the reader to the workers, which write every block at its
+// final offset of the preallocated output themselves. Every block in flight
+// holds one input buffer until it is written, so the buffer count bounds
+// memory
+struct BlockPipeline {
+  int in_fd;
+  const std::vector<Extent> &extents;
+  int out_fd;
+  // Output offset of every block when known upfront, otherwise blocks are
+  // placed back to back from out_offset as their sizes become known
+  const std::vector<uint64_t> &out_offsets;
+  uint64_t out_offset;
+  const BlockTransform &transform;
+
+  bool use_io_uring = false;
+  IoRing read_ring{};
+  std::vector<std::vector<Byte>> buffers{};
+
+  std::mutex mutex{};
+  std::condition_variable changed{};
+  std::vector<int> free_buffers{};
+  std::deque<PipelineJob> jobs{};
+  bool reading_done = false;
+
+  // Finished blocks waiting for the blocks before them to be placed
+  std::map<uint32_t, PipelineJob> unplaced{};
+  uint32_t next_unplaced = 0;
+};
+
 // Utils
 
 std::streampos get_file_size(std::ifstream &file);
-std::string byte_to_bit_string(Byte byte);
-std::string bytes_to_bit_string(const std::vector<Byte> &bytes);
+uint64_t clock_ns(clockid_t clock);
+uint64_t process_cpu_ns();
+void start_stats();
+int open_perf_counter(uint64_t type, uint64_t config, int group_fd);
+template <typename T> void put_value(std::vector<Byte> &bytes, T value);
+template <typename T>
+bool get_value(const Byte *&cursor, const Byte *end, T &value);
+Isa select_isa();
+Isa active_isa();
+template <typename Kernel, Kernel Function> Kernel isa_kernel();
+// The variant of a kernel for the instruction set picked at startup
+#define ISA_KERNEL(...) isa_kernel<decltype(&__VA_ARGS__), &__VA_ARGS__>()
 
 // UI
 
@@ -51,44 +777,278 @@ void show_help(bool intended = false);
 void handle_args(int argc, char **argv);
 void file_compressed_message(uint32_t data_size, uint32_t compressed_size,
                              const char *filename);
+void estimate_message(const SizeEstimate &estimate, const std::string &name);
+bool parse_level(const std::string &arg, int &level);
+bool parse_coder(const std::string &arg, int &coder);
+bool parse_symbols(const std::string &arg, int &symbols);
+bool parse_filter(const std::string &arg, Options &options);
+bool parse_threads(const std::string &arg, unsigned &threads);
+bool parse_memory_limit(const std::string &arg, uint64_t &memory_limit);
+CompressionLevel effective_level(const Options &options);
+void stats_message(const std::string &name, const Options &options);
+void exit_with_error(const std::string &message);
 
 // Huffman Algorithm
 
+void count_byte_lanes(const Byte *data, size_t size, uint32_t *counts);
+void count_bytes(const Byte *data, size_t size, uint32_t *counts);
+void count_bytes_parallel(const Byte *data, size_t size, uint64_t *counts,
+                          unsigned threads);
 std::map<Byte, uint32_t> count_frequencies(const std::vector<Byte> &data);
-HuffmanNode *build_huffman_tree(const std::map<Byte, uint32_t> &frequencies);
-void create_substitution_table(HuffmanNode *huffman_tree_root,
-                               std::map<Byte, std::string> &substitution_table,
-                               const std::string &substitute_str = "");
-void decode(HuffmanNode *root, int &index, const std::string &str,
-            std::vector<Byte> &decoded);
+std::map<Byte, uint32_t> count_frequencies(const std::vector<Byte> &data,
+                                           unsigned threads);
+template <typename Count>
+std::map<Byte, uint32_t> histogram_frequencies(const Count *counts);
+template <typename Symbol>
+HuffmanNode *build_huffman_tree(const std::map<Symbol, uint32_t> &frequencies);
+void delete_huffman_tree(HuffmanNode *root);
+double shannon_entropy(const std::map<Byte, uint32_t> &frequencies);
+bool sample_looks_incompressible(const std::vector<Byte> &data,
+                                 uint32_t sample_size);
+
+// rANS
+
+std::map<Byte, uint32_t>
+normalize_frequencies(const std::map<Byte, uint32_t> &frequencies,
+                      uint32_t raw_size);
+template <bool Write>
+size_t rans_encode_stream(const std::vector<Byte> &data,
+                          const std::map<Byte, uint32_t> &normalized,
+                          Byte *end);
+bool rans_can_win(const std::map<Byte, uint32_t> &frequencies,
+                  const std::map<Byte, uint32_t> &normalized,
+                  uint64_t data_size);
+uint64_t rans_data_size(const std::vector<Byte> &data,
+                        const std::map<Byte, uint32_t> &normalized);
+std::vector<Byte> rans_encode(const std::vector<Byte> &data,
+                              const std::map<Byte, uint32_t> &normalized);
+std::vector<Byte> rans_decode(const std::vector<Byte> &bytes,
+                              uint32_t raw_size,
+                              const std::map<Byte, uint32_t> &normalized);
+
+// Word Huffman
+
+bool is_word_byte(Byte ch);
+bool is_space_byte(Byte ch);
+WordModel build_word_model(const std::vector<Byte> &data,
+                           bool optimal_lengths);
+uint64_t word_data_size(const WordModel &model);
+void encode_word_symbols(const std::vector<uint32_t> &symbols,
+                         const std::vector<Byte> &lengths,
+                         const uint32_t *codes, BitWriter &writer);
+std::vector<Byte> encode_words(const WordModel &model);
+template <uint32_t TableBits, bool LongCodes>
+void decode_word_symbols(const Block &block, const DecodeEntry *table,
+                         const uint32_t *token_starts, const Byte *token_bytes,
+                         Byte *begin, Byte *end);
+std::vector<Byte> decode_words(const Block &block);
+
+// Canonical Huffman
+
+uint32_t alphabet_size(Byte symbol_width, size_t pairs);
+uint32_t run_length(const Byte *begin, const Byte *end);
+uint32_t literal_length(const Byte *begin, const Byte *end);
+uint64_t run_bytes(const std::vector<Byte> &data);
+std::vector<std::pair<Byte, Byte>> choose_pairs(const std::vector<Byte> &data);
+std::vector<uint16_t>
+pair_symbols(const std::vector<std::pair<Byte, Byte>> &pairs);
+template <typename Emit>
+void for_each_symbol(const std::vector<Byte> &data, Byte symbol_width,
+                     const std::vector<uint16_t> &pair_table, Emit emit);
+std::vector<uint32_t> count_symbols(const std::vector<Byte> &data,
+                                    Byte symbol_width,
+                                    const std::vector<std::pair<Byte, Byte>> &pairs);
+void tree_code_lengths(HuffmanNode *node, Byte depth,
+                       std::vector<Byte> &lengths);
+std::vector<Byte> limited_code_lengths(const std::vector<uint32_t> &counts,
+                                       uint32_t max_length, bool optimal);
+void package_merge_lengths(const std::vector<uint32_t> &counts,
+                           uint32_t max_length, std::vector<Byte> &lengths);
+std::vector<uint32_t> canonical_codes(const std::vector<Byte> &lengths);
+uint64_t canonical_bits(const std::vector<uint32_t> &counts,
+                        const std::vector<Byte> &lengths, Byte symbol_width);
+uint64_t canonical_data_size(const std::vector<uint32_t> &counts,
+                             const std::vector<Byte> &lengths,
+                             Byte symbol_width, size_t pairs);
+uint64_t plan_canonical_block(const std::vector<Byte> &data,
+                              const std::map<Byte, uint32_t> &frequencies,
+                              const CompressionLevel &level, Block &block);
+uint64_t plan_builtin_block(const uint32_t *counts, Block &block);
+void cache_table(TableCache &tables, CachedTable table);
+void use_cached_table(TableCache &tables, size_t index);
+void choose_table(const std::vector<Byte> &data, Block &block,
+                  TableCache &tables, uint32_t reuse_tables, uint64_t &size);
+void encode_symbols(const std::vector<Byte> &data, const Block &block,
+                    const uint32_t *codes,
+                    const std::vector<uint16_t> &pair_table,
+                    BitWriter &writer);
+std::vector<Byte> canonical_encode(const std::vector<Byte> &data,
+                                   const Block &block);
+std::vector<DecodeEntry> build_decode_table(const std::vector<Byte> &lengths);
+void resolve_table(const Block &block, TableCache &tables);
+uint32_t decode_table_bits(size_t table_size);
+uint32_t decode_symbol(const std::vector<DecodeEntry> &table,
+                       uint32_t table_bits, BitReader &reader);
+template <uint32_t TableBits, bool LongCodes>
+uint32_t lookup_symbol(const DecodeEntry *table, BitReader &reader);
+template <Byte SymbolWidth, uint32_t TableBits, bool LongCodes>
+void decode_symbols(const Block &block, const DecodeEntry *table, Byte *begin,
+                    Byte *end);
+uint32_t average_code_length(const DecodeEntry *table, size_t table_size);
+std::vector<MultiDecodeEntry> build_multi_decode_table(const DecodeEntry *table,
+                                                       size_t table_size);
+template <uint32_t TableBits, bool LongCodes>
+void decode_multi_symbols(const Block &block, const DecodeEntry *table,
+                          const MultiDecodeEntry *multi_table, Byte *begin,
+                          Byte *end);
+std::vector<Byte> canonical_decode(const Block &block,
+                                   const DecodeEntry *table,
+                                   size_t table_size);
+
+// Burrows-Wheeler Transform
+
+std::vector<int32_t> suffix_array(const std::vector<int32_t> &text,
+                                  int32_t alphabet_size);
+uint32_t bwt_stream_size(uint32_t size);
+std::vector<Byte> bwt_forward(const std::vector<Byte> &data,
+                              uint32_t start_rows[BWT_STREAMS]);
+std::vector<Byte> bwt_inverse(const std::vector<Byte> &bwt,
+                              const uint32_t start_rows[BWT_STREAMS]);
+std::vector<uint16_t> mtf_encode(const std::vector<Byte> &data);
+uint64_t plan_bwt_block(const std::vector<Byte> &data, Block &block,
+                        std::vector<uint16_t> &symbols, bool optimal_lengths);
+std::vector<Byte> bwt_encode(const std::vector<uint16_t> &symbols,
+                             const Block &block);
+std::vector<Byte> bwt_decode(const Block &block);
+
+// Filters
+
+template <typename T>
+void delta_encode_elements(const Byte *in, Byte *out, size_t count);
+template <typename T> void delta_decode_elements(Byte *data, size_t count);
+template <int Stride>
+void shuffle_elements(const Byte *in, Byte *out, size_t count);
+template <int Stride>
+void unshuffle_elements(const Byte *in, Byte *out, size_t count);
+void shuffle_bytes(const Byte *in, Byte *out, size_t count, Byte stride);
+void unshuffle_bytes(const Byte *in, Byte *out, size_t count, Byte stride);
+std::vector<Byte> filter_block(const std::vector<Byte> &data, Byte filter,
+                               Byte width);
+std::vector<Byte> unfilter_block(std::vector<Byte> data, Byte filter,
+                                 Byte width);
+double n_log2_n(uint64_t n);
+double histogram_cost(const uint32_t *counts);
+uint64_t table_coded_size(const std::map<Byte, uint32_t> &frequencies);
+std::vector<std::vector<Byte>> filtered_parts(std::vector<Byte> filtered,
+                                              Byte filter, Byte width);
 
 // File IO
 
-std::vector<Byte> read_uncompressed_file(const char *filename);
-uint32_t read_compressed_file(const char *filename, std::vector<Byte> &data,
-                              std::map<Byte, uint32_t> &frequencies);
-void write_uncompressed_file(const std::vector<Byte> &data,
-                             const char *filename);
-void write_compressed_file(uint32_t original_file_size,
-                           std::string &compressed_data, uint32_t padding,
-                           const std::map<Byte, uint32_t> &frequencies,
-                           const char *filename);
+std::vector<Byte> read_file_block(std::ifstream &file, uint64_t offset,
+                                  uint32_t size);
+std::vector<Byte> serialize_word_table(const Block &block);
+bool deserialize_word_table(const Byte *&cursor, const Byte *end, Block &block);
+bool deserialize_code_lengths(const Byte *&cursor, const Byte *end,
+                              Block &block);
+uint32_t listed_lengths_size(const std::vector<Byte> &lengths);
+void put_code_lengths(std::vector<Byte> &bytes,
+                      const std::vector<Byte> &lengths);
+bool get_code_lengths(const Byte *&cursor, const Byte *end,
+                      std::vector<Byte> &lengths);
+std::vector<Byte> pack_code_lengths(const std::vector<Byte> &lengths);
+bool unpack_code_lengths(const Byte *&cursor, const Byte *end,
+                         std::vector<Byte> &lengths);
+std::vector<Byte> serialize_block(const Block &block);
+bool deserialize_block(const std::vector<Byte> &bytes, Block &block);
+uint32_t static_table_id(const std::vector<Byte> &lengths);
+void generate_static_tables(const std::vector<const char *> &files);
+bool io_ring_setup(IoRing &ring, unsigned entries);
+void io_ring_destroy(IoRing &ring);
+bool io_ring_register_buffers(IoRing &ring,
+                              std::vector<std::vector<Byte>> &buffers);
+bool io_ring_queue(IoRing &ring, Byte opcode, int fd, void *buffer,
+                   uint32_t length, uint64_t offset, uint64_t user_data,
+                   int buffer_index);
+bool io_ring_submit(IoRing &ring, unsigned wait_count);
+bool io_ring_reap(IoRing &ring, uint64_t &user_data, int32_t &result);
+void read_fully(int fd, Byte *buffer, uint32_t length, uint64_t offset);
+void write_fully(int fd, const Byte *buffer, size_t length, uint64_t offset);
+void preallocate_file(int fd, uint64_t size);
+void pipeline_read_blocks(BlockPipeline &pipeline);
+void pipeline_transform_blocks(BlockPipeline &pipeline);
+uint64_t run_block_pipeline(int in_fd, const std::vector<Extent> &extents,
+                            int out_fd, const std::vector<uint64_t> &out_offsets,
+                            uint64_t out_offset,
+                            const BlockTransform &transform,
+                            const PipelinePlan &plan, const Options &options);
+bool plan_pipeline(uint64_t memory_limit, uint64_t block_memory,
+                   uint64_t worker_memory, PipelinePlan &plan);
+uint64_t pipeline_memory(uint64_t block_memory, uint64_t worker_memory,
+                         const PipelinePlan &plan);
 
 // Compression
 
-uint32_t compress(const std::vector<Byte> &data, const char *filename);
-void compress_to_file(const char *from_file, const char *_to_file);
+std::vector<uint32_t>
+split_block(const std::vector<Byte> &data,
+            std::vector<std::vector<uint32_t>> &histograms);
+std::vector<Byte> compress_split_block(const std::vector<Byte> &data,
+                                       const CompressionLevel &level);
+Block compress_block(const std::vector<Byte> &data,
+                     const CompressionLevel &level, TableCache *tables);
+Block encode_block(const std::vector<Byte> &data,
+                   const CompressionLevel &level, TableCache *tables);
+bool encode_filtered_block(const std::vector<Byte> &data,
+                           const CompressionLevel &level, Block &block);
+uint64_t compress_memory(const CompressionLevel &level, uint32_t block_size,
+                         uint64_t &worker_memory);
+PipelinePlan plan_compression(const CompressionLevel &level,
+                              uint32_t file_size, const Options &options);
+void put_file_header(std::vector<Byte> &bytes, uint32_t original_size);
+void compress_buffer(const Byte *data, uint64_t size,
+                     const CompressionLevel &level, std::vector<Byte> &output);
+void compress_to_file(const char *from_file, const char *_to_file,
+                      const Options &options);
+
+// Estimation
+
+SizeEstimate estimate_block(const std::vector<Byte> &data,
+                            const std::map<Byte, uint32_t> &frequencies,
+                            const CompressionLevel &level, TableCache *tables);
+SizeEstimate estimate_split_block(const std::vector<Byte> &data,
+                                  const uint64_t *counts,
+                                  const CompressionLevel &level);
+SizeEstimate estimate_file(const char *filename, bool sample,
+                           const CompressionLevel &level, unsigned threads,
+                           std::vector<SizeEstimate> &block_estimates);
 
 // Decompression
 
-std::vector<Byte> decompress(std::string &bits, uint32_t padding,
-                             const std::map<Byte, uint32_t> &frequencies);
-void decompress_to_file(const char *from_file, const char *to_file);
+std::vector<Byte> decompress_block(const Block &block);
+std::vector<Byte> decode_inner_blocks(const Block &block);
+std::vector<Byte> decode_block(const Block &block, TableCache *tables);
+uint64_t decode_memory(Byte type, uint32_t raw_size, uint32_t payload_size);
+void get_file_header(const Byte *&cursor, const Byte *end,
+                     const std::string &name, uint32_t &original_size);
+void decompress_buffer(const Byte *data, uint64_t size,
+                       std::vector<Byte> &output);
+void decompress_to_file(const char *from_file, const char *to_file,
+                        const Options &options);
+
+// Server
+
+void serve(const char *socket_path, const Options &options);
+void serve_connections(int listen_fd, const Options &options);
+bool serve_request(int fd, const Options &options, std::vector<Byte> &input,
+                   std::vector<Byte> &output);
+bool receive_fully(int fd, Byte *buffer, size_t size, std::vector<int> &fds);
+bool send_response(int fd, Byte status, uint64_t size,
+                   const std::vector<Byte> &body);
 
 // Main
 
 int main(int argc, char **argv) {
   COMPRESSED_FILE_EXTENSION = std::string(".huff");
+  active_isa();
   handle_args(argc, argv);
   return 0;
 }
@@ -104,21 +1064,209 @@ std::streampos get_file_size(std::ifstream &file) {
   return file_size;
 }
 
-std::string byte_to_bit_string(Byte byte) {
-  return std::bitset<CHAR_BIT>(byte).to_string();
+uint64_t wall_clock_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+uint64_t clock_ns(clockid_t clock) {
+  timespec time;
+  clock_gettime(clock, &time);
+  return uint64_t(time.tv_sec) * 1000000000 + time.tv_nsec;
+}
+
+uint64_t thread_cpu_ns() { return clock_ns(CLOCK_THREAD_CPUTIME_ID); }
+
+uint64_t process_cpu_ns() { return clock_ns(CLOCK_PROCESS_CPUTIME_ID); }
+
+template <typename T> void put_value(std::vector<Byte> &bytes, T value) {
+  const Byte *raw = reinterpret_cast<const Byte *>(&value);
+  bytes.insert(bytes.end(), raw, raw + sizeof(value));
+}
+
+template <typename T>
+bool get_value(const Byte *&cursor, const Byte *end, T &value) {
+  if (size_t(end - cursor) < sizeof(value))
+    return false;
+
+  std::memcpy(&value, cursor, sizeof(value));
+  cursor += sizeof(value);
+  return true;
+}
+
+Isa select_isa() {
+  Isa supported = ISA_BASELINE;
+#if defined(__x86_64__) && defined(__GNUC__)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("x86-64-v4"))
+    supported = ISA_X86_64_V4;
+  else if (__builtin_cpu_supports("x86-64-v3"))
+    supported = ISA_X86_64_V3;
+  else if (__builtin_cpu_supports("x86-64-v2"))
+    supported = ISA_X86_64_V2;
+#endif
+
+  const char *name = std::getenv("HUFFMAN_ISA");
+  if (!name)
+    return std::min(supported, ISA_DEFAULT_MAX);
+
+  for (int isa = ISA_BASELINE; isa < ISA_COUNT; ++isa) {
+    if (std::strcmp(name, ISA_NAMES[isa]))
+      continue;
+    if (isa > supported)
+      exit_with_error(std::string("HUFFMAN_ISA=") + name +
+                      " is not supported by this CPU");
+    return Isa(isa);
+  }
+  exit_with_error(std::string("HUFFMAN_ISA=") + name +
+                  " is none of baseline, x86-64-v2, x86-64-v3 and x86-64-v4");
+  return ISA_BASELINE;
+}
+
+Isa active_isa() {
+  static const Isa isa = select_isa();
+  return isa;
 }
 
-std::string bytes_to_bit_string(const std::vector<Byte> &bytes) {
-  std::string bits;
-  bits.reserve(bytes.size() * CHAR_BIT);
+template <typename Kernel, Kernel Function> Kernel isa_kernel() {
+  switch (active_isa()) {
+  case ISA_X86_64_V2:
+    return IsaKernels<Kernel, Function>::x86_64_v2;
+  case ISA_X86_64_V3:
+    return IsaKernels<Kernel, Function>::x86_64_v3;
+  case ISA_X86_64_V4:
+    return IsaKernels<Kernel, Function>::x86_64_v4;
+  default:
+    return Function;
+  }
+}
 
-  for (auto byte : bytes) {
-    bits += byte_to_bit_string(byte);
+void start_stats() {
+  for (auto &stage : STATS.stages) {
+    stage.wall_ns = 0;
+    stage.cpu_ns = 0;
+    stage.bytes = 0;
   }
+  STATS.blocks = 0;
+  STATS.bytes_in = 0;
+  STATS.bytes_out = 0;
+  STATS.threads = 1;
+  STATS.start_wall_ns = wall_clock_ns();
+  STATS.start_cpu_ns = process_cpu_ns();
 
-  return bits;
+  for (auto &stage : STATS.stages) {
+    for (auto &counter : stage.perf) {
+      counter = 0;
+    }
+  }
+}
+
+#ifdef __linux__
+
+int open_perf_counter(uint64_t type, uint64_t config, int group_fd) {
+  perf_event_attr attr = {};
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  attr.disabled = group_fd == -1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID |
+                     PERF_FORMAT_TOTAL_TIME_ENABLED |
+                     PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+  // Counts the calling thread on any CPU
+  return syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0);
+}
+
+bool read_perf_counters(uint64_t values[PERF_COUNTER_COUNT]) {
+  // Opened on the first read of every thread and closed when it exits, a
+  // counter the CPU does not have stays at -1 and reads as 0
+  struct PerfGroup {
+    int leader = -1;
+    int fds[PERF_COUNTER_COUNT] = {-1, -1, -1, -1, -1};
+    uint64_t ids[PERF_COUNTER_COUNT] = {};
+    bool opened = false;
+
+    ~PerfGroup() {
+      for (int fd : fds) {
+        if (fd != -1)
+          close(fd);
+      }
+    }
+  };
+  thread_local PerfGroup group;
+
+  if (!group.opened) {
+    group.opened = true;
+
+    const uint64_t types[PERF_COUNTER_COUNT] = {
+        PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+        PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE};
+    const uint64_t configs[PERF_COUNTER_COUNT] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_BRANCH_MISSES,
+        PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+            (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+        PERF_COUNT_HW_CACHE_MISSES};
+
+    for (int i = 0; i < PERF_COUNTER_COUNT; ++i) {
+      int fd = open_perf_counter(types[i], configs[i], group.leader);
+      if (fd == -1) {
+        if (i == PERF_CYCLES) {
+          int expected = 0;
+          STATS.perf_errno.compare_exchange_strong(expected, errno);
+          return false;
+        }
+        continue;
+      }
+
+      group.fds[i] = fd;
+      if (i == PERF_CYCLES)
+        group.leader = fd;
+      ioctl(fd, PERF_EVENT_IOC_ID, &group.ids[i]);
+    }
+
+    ioctl(group.leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+
+  if (group.leader == -1)
+    return false;
+
+  // nr, time enabled, time running, then a (value, id) pair per counter
+  uint64_t buffer[3 + 2 * PERF_COUNTER_COUNT];
+  if (read(group.leader, buffer, sizeof(buffer)) <= 0)
+    return false;
+
+  // Scale up when the group had to share the PMU with other events
+  double scale = buffer[2] ? double(buffer[1]) / buffer[2] : 0;
+
+  for (int i = 0; i < PERF_COUNTER_COUNT; ++i) {
+    values[i] = 0;
+    for (uint64_t j = 0; j < buffer[0]; ++j) {
+      if (group.ids[i] && buffer[3 + 2 * j + 1] == group.ids[i])
+        values[i] = static_cast<uint64_t>(buffer[3 + 2 * j] * scale);
+    }
+  }
+
+  return true;
 }
 
+#else
+
+int open_perf_counter(uint64_t type, uint64_t config, int group_fd) {
+  return -1;
+}
+
+bool read_perf_counters(uint64_t values[PERF_COUNTER_COUNT]) {
+  int expected = 0;
+  STATS.perf_errno.compare_exchange_strong(expected, ENOSYS);
+  return false;
+}
+
+#endif
+
 // UI
 
 void show_help(bool intended) {
@@ -138,270 +1286,3957 @@ void show_help(bool intended) {
             << std::endl
             << std::endl;
 
+  std::cout << "Compression levels go from -1 (fastest) to -9 (best), -"
+            << DEFAULT_LEVEL << " is the default" << std::endl;
+  std::cout << "--coder=huffman|rans|auto picks the entropy coder, by default"
+            << std::endl
+            << "levels up to -" << DEFAULT_LEVEL
+            << " use huffman, -7 and -8 auto and -9 bwt. --coder=words"
+            << std::endl
+            << "codes whole words of text and logs with huffman, --coder=bwt"
+            << std::endl
+            << "also tries a Burrows-Wheeler transform before huffman"
+            << std::endl;
+  std::cout << "--symbols=8|16|pairs codes bytes, 16 bit values or bytes and"
+            << std::endl
+            << "frequent byte pairs with huffman, -8 and -9 use pairs"
+            << std::endl;
+  std::cout << "--filter=delta:1|2|4|8 codes the differences of 1 to 8 byte"
+            << std::endl
+            << "little endian values in blocks where that lowers the entropy,"
+            << std::endl
+            << "--filter=shuffle:N groups byte i of every N byte record"
+            << std::endl
+            << std::endl;
+
   std::cout << "To decompress a file" << std::endl;
   std::cout << "./huffman -d/--decompress [input file name] [output file name]"
             << std::endl
             << std::endl;
 
+  std::cout << "To estimate the compressed size without compressing"
+            << std::endl;
+  std::cout << "./huffman --estimate[=blocks] [--sample] [input file name]..."
+            << std::endl
+            << std::endl;
+
+  std::cout << "To train the built-in tables for small blocks, then rebuild"
+            << std::endl;
+  std::cout << "./huffman --generate-tables [text file] [json file] "
+               "[binary file] [header file]"
+            << std::endl
+            << std::endl;
+
+  std::cout << "To compress and decompress for other processes over a Unix"
+            << std::endl
+            << "socket, see the README for the protocol" << std::endl;
+  std::cout << "./huffman --serve [socket path]" << std::endl << std::endl;
+
+  std::cout << "Blocks are processed by --threads=N worker threads, files are"
+            << std::endl
+            << "read and written with io_uring where available, --io=pread"
+            << std::endl
+            << "forces plain pread and pwrite. --memory-limit=N[K|M|G] bounds"
+            << std::endl
+            << "the working memory, with fewer threads and, when compressing,"
+            << std::endl
+            << "smaller blocks" << std::endl
+            << std::endl;
+
+  std::cout << "Add --stats or --stats=json to any command to report the time"
+            << std::endl
+            << "and throughput of every stage on stderr, --perf also reports"
+            << std::endl
+            << "hardware performance counters per stage" << std::endl
+            << std::endl;
+
   std::cout << "To show this help" << std::endl;
   std::cout << "./huffman -h/--help" << std::endl;
 }
 
 void handle_args(int argc, char **argv) {
-  switch (argc) {
-  case 2: {
-    if (argv[1] == std::string("-h") || argv[1] == std::string("--help")) {
+  Options options;
+  std::vector<const char *> files;
+
+  for (int i = 1; i < argc; ++i) {
+    std::string arg(argv[i]);
+
+    if (arg == "-h" || arg == "--help") {
       show_help(true);
+      return;
+    } else if (arg == "-d" || arg == "--decompress") {
+      options.decompress = true;
+    } else if (arg == "-c" || arg == "--compress") {
+      options.decompress = false;
+    } else if (arg == "--estimate") {
+      options.estimate = true;
+    } else if (arg == "--estimate=blocks") {
+      options.estimate = true;
+      options.estimate_blocks = true;
+    } else if (arg == "--sample") {
+      options.sample = true;
+    } else if (arg == "--generate-tables") {
+      options.generate_tables = true;
+    } else if (arg == "--serve") {
+      options.serve = true;
+    } else if (arg == "--stats") {
+      options.stats = true;
+    } else if (arg == "--stats=json") {
+      options.stats = true;
+      options.stats_json = true;
+    } else if (arg == "--perf") {
+      options.stats = true;
+      STATS.perf = true;
+    } else if (arg == "--io=uring") {
+      options.io = IO_URING;
+    } else if (arg == "--io=pread") {
+      options.io = IO_PREAD;
+    } else if (parse_threads(arg, options.threads) ||
+               parse_level(arg, options.level) ||
+               parse_coder(arg, options.coder) ||
+               parse_symbols(arg, options.symbols) ||
+               parse_filter(arg, options) ||
+               parse_memory_limit(arg, options.memory_limit)) {
+      continue;
+    } else if (arg.length() > 1 && arg[0] == '-') {
+      show_help();
+      return;
+    } else {
+      files.push_back(argv[i]);
     }
-    break;
   }
 
-  case 3: {
-    compress_to_file(argv[1], argv[2]);
-    break;
-  }
+  if (options.generate_tables && files.size() == STATIC_TABLES + 1) {
+
+    generate_static_tables(files);
+
+  } else if (options.generate_tables) {
+    show_help();
+  } else if (options.serve && files.size() == 1) {
 
-  case 4: {
-    if (argv[1] == std::string("-d") ||
-        argv[1] == std::string("--decompress")) {
+    serve(files[0], options);
 
-      decompress_to_file(argv[2], argv[3]);
+  } else if (options.serve) {
+    show_help();
+  } else if (options.estimate && !files.empty()) {
 
-    } else if (argv[1] == std::string("-c") ||
-               argv[1] == std::string("--compress")) {
+    for (auto file : files) {
+      start_stats();
 
-      compress_to_file(argv[2], argv[3]);
+      // With --memory-limit, the blocks compression would shrink to
+      CompressionLevel level = effective_level(options);
+      struct stat file_stat;
+      if (options.memory_limit && stat(file, &file_stat) == 0 &&
+          uint64_t(file_stat.st_size) <= UINT32_MAX)
+        level.block_size =
+            plan_compression(level, file_stat.st_size, options).block_size;
 
-    } else {
-      show_help();
+      std::vector<SizeEstimate> block_estimates;
+      SizeEstimate estimate = estimate_file(
+          file, options.sample, level, options.threads, block_estimates);
+
+      estimate_message(estimate, file);
+      if (options.estimate_blocks) {
+        for (const auto &block_estimate : block_estimates) {
+          estimate_message(block_estimate,
+                           "  block " + std::to_string(block_estimate.block));
+        }
+      }
+
+      if (options.stats)
+        stats_message(file, options);
     }
-    break;
-  }
 
-  default: {
+  } else if (!options.estimate && files.size() == 2) {
+
+    start_stats();
+
+    if (options.decompress)
+      decompress_to_file(files[0], files[1], options);
+    else
+      compress_to_file(files[0], files[1], options);
+
+    if (options.stats)
+      stats_message(files[0], options);
+
+  } else {
     show_help();
-    break;
-  }
   }
 }
 
 void file_compressed_message(uint32_t data_size, uint32_t compressed_size,
                              const char *filename) {
+  std::cout << filename << " was compressed from " << data_size
+            << " bytes, to " << compressed_size << " bytes." << std::endl;
+
   if (compressed_size < data_size) {
     double percentage_reduction =
         double(data_size - compressed_size) / data_size * 100;
-    std::cout << filename << " was compressed from " << data_size
-              << " bytes, to " << compressed_size << " bytes.\nSaving "
-              << percentage_reduction << "% space";
+    std::cout << "Saving " << percentage_reduction << "% space" << std::endl;
+  } else {
+    std::cout << "The file could not be compressed, it grew by "
+              << compressed_size - data_size << " bytes" << std::endl;
   }
 }
 
-// Huffman Algorithm
+void estimate_message(const SizeEstimate &estimate, const std::string &name) {
+  double ratio = estimate.original_size
+                     ? double(estimate.compressed_size) / estimate.original_size
+                     : 0;
 
-std::map<Byte, uint32_t> count_frequencies(const std::vector<Byte> &data) {
-  std::map<Byte, uint32_t> frequencies;
+  std::cout << name << ": " << estimate.original_size << " bytes -> "
+            << estimate.compressed_size << " bytes, ratio " << ratio
+            << ", entropy " << estimate.entropy << " bits/byte";
 
-  for (auto byte : data) {
-    frequencies[byte]++;
-  }
+  if (estimate.blocks == 1 && estimate.type == BLOCK_STORED)
+    std::cout << ", stored";
+  else if (estimate.blocks == 1 && estimate.type == BLOCK_RANS)
+    std::cout << ", rans";
+  else if (estimate.blocks == 1 && estimate.type == BLOCK_WORDS)
+    std::cout << ", words";
+  else if (estimate.blocks == 1 && estimate.type == BLOCK_BWT)
+    std::cout << ", bwt";
+  else if (estimate.blocks == 1 && estimate.type == BLOCK_FILTERED)
+    std::cout << ", filtered";
 
-  return frequencies;
+  if (estimate.sampled_blocks < estimate.blocks)
+    std::cout << ", sampled " << estimate.sampled_blocks << " of "
+              << estimate.blocks << " blocks";
+
+  std::cout << std::endl;
 }
 
-void create_substitution_table(HuffmanNode *huffman_tree_root,
-                               std::map<Byte, std::string> &substitution_table,
-                               const std::string &substitute_str) {
-  if (!huffman_tree_root)
-    return;
+void stats_message(const std::string &name, const Options &options) {
+  double wall_s = (wall_clock_ns() - STATS.start_wall_ns) / 1e9;
+  double cpu_s = (process_cpu_ns() - STATS.start_cpu_ns) / 1e9;
+  double utilization = wall_s > 0 ? cpu_s / (wall_s * STATS.threads) : 0;
 
-  // found a leaf node
-  if (!huffman_tree_root->left && !huffman_tree_root->right) {
-    substitution_table[huffman_tree_root->byte] = substitute_str;
-  }
+  rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  long peak_rss_kb = usage.ru_maxrss;
 
-  create_substitution_table(huffman_tree_root->left, substitution_table,
-                            substitute_str + LEFT_CHAR);
-  create_substitution_table(huffman_tree_root->right, substitution_table,
-                            substitute_str + RIGHT_CHAR);
-}
+  bool perf_available = STATS.perf && !STATS.perf_errno;
 
-HuffmanNode *build_huffman_tree(const std::map<Byte, uint32_t> &frequencies) {
-  std::priority_queue<HuffmanNode *, std::vector<HuffmanNode *>,
-                      greater_frequency>
-      nodeHeap;
+  auto mb_per_s = [](uint64_t bytes, double seconds) {
+    return seconds > 0 ? bytes / 1048576.0 / seconds : 0;
+  };
 
-  for (auto pair : frequencies) {
-    nodeHeap.push(new HuffmanNode(pair.first, pair.second));
-  }
+  if (options.stats_json) {
+    // A single line, so it can go straight into a log pipeline
+    std::string escaped_name;
+    for (char ch : name) {
+      if (ch == '"' || ch == '\\')
+        escaped_name += '\\';
+      escaped_name += ch;
+    }
 
-  while (nodeHeap.size() > 1) {
-    HuffmanNode *left = nodeHeap.top();
-    nodeHeap.pop();
-    HuffmanNode *right = nodeHeap.top();
-    nodeHeap.pop();
-    nodeHeap.push(new HuffmanNode(left, right));
-  }
+    std::cerr << "{\"file\":\"" << escaped_name << "\",\"operation\":\""
+              << (options.estimate     ? "estimate"
+                  : options.decompress ? "decompress"
+                                       : "compress")
+              << "\",\"bytes_in\":" << STATS.bytes_in
+              << ",\"bytes_out\":" << STATS.bytes_out
+              << ",\"blocks\":" << STATS.blocks << ",\"wall_s\":" << wall_s
+              << ",\"cpu_s\":" << cpu_s << ",\"mb_per_s\":"
+              << mb_per_s(STATS.bytes_in, wall_s)
+              << ",\"peak_rss_kb\":" << peak_rss_kb
+              << ",\"threads\":" << STATS.threads << ",\"isa\":\""
+              << ISA_NAMES[active_isa()] << "\""
+              << ",\"thread_utilization\":" << utilization
+              << ",\"stages\":{";
 
-  return nodeHeap.top();
-}
+    for (int i = 0; i < STAGE_COUNT; ++i) {
+      const StageStats &stage = STATS.stages[i];
+      std::cerr << (i ? "," : "") << "\"" << STAGE_NAMES[i]
+                << "\":{\"wall_s\":" << stage.wall_ns / 1e9
+                << ",\"cpu_s\":" << stage.cpu_ns / 1e9
+                << ",\"bytes\":" << stage.bytes << ",\"mb_per_s\":"
+                << mb_per_s(stage.bytes, stage.wall_ns / 1e9);
 
-void decode(HuffmanNode *root, int &index, const std::string &str,
-            std::vector<Byte> &decoded) {
-  if (!root)
-    return;
+      if (perf_available) {
+        for (int j = 0; j < PERF_COUNTER_COUNT; ++j) {
+          std::cerr << ",\"" << PERF_COUNTER_NAMES[j]
+                    << "\":" << stage.perf[j];
+        }
+      }
+      std::cerr << "}";
+    }
+    std::cerr << "}";
 
-  if (!root->left && !root->right) {
-    decoded.push_back(root->byte);
+    if (STATS.perf && !perf_available)
+      std::cerr << ",\"perf_error\":\"" << std::strerror(STATS.perf_errno)
+                << "\"";
+    std::cerr << "}" << std::endl;
     return;
   }
 
-  ++index;
+  std::ios saved_format(nullptr);
+  saved_format.copyfmt(std::cerr);
+  std::cerr << std::fixed << std::setprecision(2);
+  std::cerr << name << ": " << STATS.bytes_in << " bytes in, "
+            << STATS.bytes_out << " bytes out, " << STATS.blocks
+            << " blocks" << std::endl;
+  std::cerr << std::left << std::setw(10) << "stage" << std::right
+            << std::setw(12) << "wall ms" << std::setw(12) << "cpu ms"
+            << std::setw(12) << "MB" << std::setw(12) << "MB/s" << std::endl;
 
-  if (str[index] == LEFT_CHAR)
-    decode(root->left, index, str, decoded);
-  else
-    decode(root->right, index, str, decoded);
-}
+  for (int i = 0; i < STAGE_COUNT; ++i) {
+    const StageStats &stage = STATS.stages[i];
+    std::cerr << std::left << std::setw(10) << STAGE_NAMES[i] << std::right
+              << std::setw(12) << stage.wall_ns / 1e6 << std::setw(12)
+              << stage.cpu_ns / 1e6 << std::setw(12)
+              << stage.bytes / 1048576.0 << std::setw(12)
+              << mb_per_s(stage.bytes, stage.wall_ns / 1e9) << std::endl;
+  }
 
-// File IO
+  std::cerr << std::left << std::setw(10) << "total" << std::right
+            << std::setw(12) << wall_s * 1e3 << std::setw(12) << cpu_s * 1e3
+            << std::setw(12) << STATS.bytes_in / 1048576.0 << std::setw(12)
+            << mb_per_s(STATS.bytes_in, wall_s) << std::endl;
+  std::cerr << "peak RSS " << peak_rss_kb << " KiB, " << STATS.threads
+            << " threads, " << utilization * 100 << "% thread utilization, "
+            << ISA_NAMES[active_isa()] << " kernels" << std::endl;
 
-std::vector<Byte> read_uncompressed_file(const char *filename) {
-  std::ifstream output_file(filename, std::ios::binary);
+  if (STATS.perf && !perf_available) {
+    std::cerr << "hardware counters unavailable: "
+              << std::strerror(STATS.perf_errno) << std::endl;
+  } else if (perf_available) {
+    std::cerr << std::left << std::setw(10) << "stage" << std::right
+              << std::setw(12) << "cycles/B" << std::setw(12) << "IPC"
+              << std::setw(14) << "br-miss" << std::setw(14) << "L1D-miss"
+              << std::setw(14) << "LLC-miss" << std::endl;
 
-  output_file.unsetf(std::ios::skipws);
+    for (int i = 0; i < STAGE_COUNT; ++i) {
+      const StageStats &stage = STATS.stages[i];
+      uint64_t cycles = stage.perf[PERF_CYCLES];
+      std::cerr << std::left << std::setw(10) << STAGE_NAMES[i] << std::right
+                << std::setw(12)
+                << (stage.bytes ? double(cycles) / stage.bytes : 0)
+                << std::setw(12)
+                << (cycles ? double(stage.perf[PERF_INSTRUCTIONS]) / cycles
+                           : 0)
+                << std::setw(14) << stage.perf[PERF_BRANCH_MISSES]
+                << std::setw(14) << stage.perf[PERF_L1D_MISSES]
+                << std::setw(14) << stage.perf[PERF_LLC_MISSES] << std::endl;
+    }
+  }
+  std::cerr.copyfmt(saved_format);
+}
 
-  std::streampos file_size = get_file_size(output_file);
+void exit_with_error(const std::string &message) {
+  if (SERVING)
+    throw RequestError(message);
 
-  std::vector<Byte> vec;
-  vec.reserve(file_size);
+  std::cerr << message << std::endl;
+  std::exit(EXIT_FAILURE);
+}
 
-  vec.insert(vec.begin(), std::istream_iterator<Byte>(output_file),
-             std::istream_iterator<Byte>());
+bool parse_level(const std::string &arg, int &level) {
+  if (arg.length() != 2 || arg[0] != '-' || arg[1] < '0' + MIN_LEVEL ||
+      arg[1] > '0' + MAX_LEVEL)
+    return false;
 
-  return vec;
+  level = arg[1] - '0';
+  return true;
 }
 
-uint32_t read_compressed_file(const char *filename, std::vector<Byte> &data,
-                              std::map<Byte, uint32_t> &frequencies) {
-  std::ifstream input_file(filename, std::ios::binary);
-  input_file.unsetf(std::ios::skipws);
+bool parse_coder(const std::string &arg, int &coder) {
+  if (arg == "--coder=huffman")
+    coder = CODER_HUFFMAN;
+  else if (arg == "--coder=rans")
+    coder = CODER_RANS;
+  else if (arg == "--coder=auto")
+    coder = CODER_AUTO;
+  else if (arg == "--coder=words")
+    coder = CODER_WORDS;
+  else if (arg == "--coder=bwt")
+    coder = CODER_BWT;
+  else
+    return false;
 
-  // Read header
+  return true;
+}
 
-  uint32_t original_file_size;
-  input_file.read(reinterpret_cast<char *>(&original_file_size),
-                  sizeof(original_file_size));
+bool parse_symbols(const std::string &arg, int &symbols) {
+  if (arg == "--symbols=8")
+    symbols = SYMBOLS_8;
+  else if (arg == "--symbols=16")
+    symbols = SYMBOLS_16;
+  else if (arg == "--symbols=pairs")
+    symbols = SYMBOLS_PAIRS;
+  else
+    return false;
+
+  return true;
+}
+
+bool parse_filter(const std::string &arg, Options &options) {
+  const std::string delta = "--filter=delta:";
+  const std::string shuffle = "--filter=shuffle:";
+
+  if (arg.rfind(delta, 0) == 0) {
+    std::string width = arg.substr(delta.length());
+    if (width != "1" && width != "2" && width != "4" && width != "8")
+      return false;
+
+    options.filter = FILTER_DELTA;
+    options.filter_width = std::stoi(width);
+    return true;
+  }
+
+  if (arg.rfind(shuffle, 0) == 0) {
+    std::string stride = arg.substr(shuffle.length());
+    if (stride.empty() || stride.size() > 3 ||
+        stride.find_first_not_of("0123456789") != std::string::npos ||
+        std::stoi(stride) < 2 || std::stoi(stride) > UCHAR_MAX)
+      return false;
+
+    options.filter = FILTER_SHUFFLE;
+    options.filter_width = std::stoi(stride);
+    return true;
+  }
+
+  return false;
+}
+
+bool parse_threads(const std::string &arg, unsigned &threads) {
+  const std::string prefix = "--threads=";
+  if (arg.rfind(prefix, 0) != 0)
+    return false;
+
+  std::string count = arg.substr(prefix.length());
+  if (count.empty() ||
+      count.find_first_not_of("0123456789") != std::string::npos)
+    return false;
+  errno = 0;
+  unsigned long value = std::strtoul(count.c_str(), nullptr, 10);
+  if (errno == ERANGE || !value)
+    return false;
+
+  unsigned cpus = std::max(1u, std::thread::hardware_concurrency());
+  threads = std::min<unsigned long>(value, cpus * MAX_THREADS_PER_CPU);
+  return true;
+}
+
+bool parse_memory_limit(const std::string &arg, uint64_t &memory_limit) {
+  const std::string prefix = "--memory-limit=";
+  if (arg.rfind(prefix, 0) != 0)
+    return false;
+
+  std::string size = arg.substr(prefix.length());
+  uint32_t shift = 0;
+  if (!size.empty() && std::strchr("KMG", size.back())) {
+    shift = size.back() == 'K' ? 10 : size.back() == 'M' ? 20 : 30;
+    size.pop_back();
+  }
+  if (size.empty() || size.size() > 12 ||
+      size.find_first_not_of("0123456789") != std::string::npos)
+    return false;
+  uint64_t value = std::stoull(size);
+  if (!value || value > UINT64_MAX >> shift)
+    return false;
+
+  memory_limit = value << shift;
+  return true;
+}
+
+CompressionLevel effective_level(const Options &options) {
+  CompressionLevel level = COMPRESSION_LEVELS[options.level];
+  if (options.coder >= 0)
+    level.coder = static_cast<Coder>(options.coder);
+  if (options.symbols >= 0)
+    level.symbols = static_cast<SymbolWidth>(options.symbols);
+  level.filter = options.filter;
+  level.filter_width = options.filter_width;
+  return level;
+}
+
+// Huffman Algorithm
+
+void count_byte_lanes(const Byte *data, size_t size, uint32_t *counts) {
+  // Count into four arrays so runs of the same byte do not serialize on a
+  // single counter
+  uint32_t partial[4][UCHAR_MAX + 1] = {};
+
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    partial[0][data[i]]++;
+    partial[1][data[i + 1]]++;
+    partial[2][data[i + 2]]++;
+    partial[3][data[i + 3]]++;
+  }
+  for (; i < size; ++i) {
+    partial[0][data[i]]++;
+  }
+
+  for (int byte = 0; byte <= UCHAR_MAX; ++byte) {
+    counts[byte] = partial[0][byte] + partial[1][byte] + partial[2][byte] +
+                   partial[3][byte];
+  }
+}
+
+void count_bytes(const Byte *data, size_t size, uint32_t *counts) {
+  ISA_KERNEL(count_byte_lanes)(data, size, counts);
+}
+
+void count_bytes_parallel(const Byte *data, size_t size, uint64_t *counts,
+                          unsigned threads) {
+  size_t chunks = (size + HISTOGRAM_CHUNK_SIZE - 1) / HISTOGRAM_CHUNK_SIZE;
+  threads = std::max<size_t>(
+      1, std::min<size_t>(threads, size / HISTOGRAM_THREAD_MIN_SIZE));
+
+  // Every thread sums its chunks in its own cache lines, which are added up
+  // once all are done, so nothing is shared or locked while counting
+  struct alignas(CACHE_LINE_SIZE) ThreadCounts {
+    uint64_t counts[UCHAR_MAX + 1] = {};
+  };
+  std::vector<ThreadCounts> thread_counts(threads);
+  std::atomic<size_t> next_chunk{0};
+  auto count_chunks = [&](ThreadCounts &local) {
+    uint32_t chunk_counts[UCHAR_MAX + 1];
+    for (size_t chunk; (chunk = next_chunk++) < chunks;) {
+      size_t start = chunk * HISTOGRAM_CHUNK_SIZE;
+      count_bytes(data + start,
+                  std::min<size_t>(HISTOGRAM_CHUNK_SIZE, size - start),
+                  chunk_counts);
+      for (int byte = 0; byte <= UCHAR_MAX; ++byte)
+        local.counts[byte] += chunk_counts[byte];
+    }
+  };
+
+  // The caller's time is already in its own histogram stage
+  std::vector<std::thread> helpers;
+  for (unsigned i = 1; i < threads; ++i) {
+    helpers.emplace_back([&, i] {
+      StageTimer timer(STAGE_HISTOGRAM);
+      count_chunks(thread_counts[i]);
+    });
+  }
+  count_chunks(thread_counts[0]);
+  for (auto &helper : helpers)
+    helper.join();
+
+  for (int byte = 0; byte <= UCHAR_MAX; ++byte) {
+    counts[byte] = 0;
+    for (const ThreadCounts &local : thread_counts)
+      counts[byte] += local.counts[byte];
+  }
+}
+
+std::map<Byte, uint32_t> count_frequencies(const std::vector<Byte> &data) {
+  return count_frequencies(data, 1);
+}
+
+std::map<Byte, uint32_t> count_frequencies(const std::vector<Byte> &data,
+                                           unsigned threads) {
+  StageTimer timer(STAGE_HISTOGRAM);
+
+  uint64_t counts[UCHAR_MAX + 1];
+  count_bytes_parallel(data.data(), data.size(), counts, threads);
+  return histogram_frequencies(counts);
+}
+
+template <typename Count>
+std::map<Byte, uint32_t> histogram_frequencies(const Count *counts) {
+  std::map<Byte, uint32_t> frequencies;
+  for (int byte = 0; byte <= UCHAR_MAX; ++byte) {
+    if (counts[byte])
+      frequencies[byte] = counts[byte];
+  }
+
+  return frequencies;
+}
+
+template <typename Symbol>
+HuffmanNode *build_huffman_tree(const std::map<Symbol, uint32_t> &frequencies) {
+  StageTimer timer(STAGE_TREE);
+
+  std::priority_queue<HuffmanNode *, std::vector<HuffmanNode *>,
+                      greater_frequency>
+      nodeHeap;
+
+  for (auto pair : frequencies) {
+    nodeHeap.push(new HuffmanNode(pair.first, pair.second));
+  }
+
+  while (nodeHeap.size() > 1) {
+    HuffmanNode *left = nodeHeap.top();
+    nodeHeap.pop();
+    HuffmanNode *right = nodeHeap.top();
+    nodeHeap.pop();
+    nodeHeap.push(new HuffmanNode(left, right));
+  }
+
+  return nodeHeap.top();
+}
+
+void delete_huffman_tree(HuffmanNode *root) {
+  if (!root)
+    return;
+
+  delete_huffman_tree(root->left);
+  delete_huffman_tree(root->right);
+  delete root;
+}
+
+double shannon_entropy(const std::map<Byte, uint32_t> &frequencies) {
+  uint64_t total = 0;
+  for (auto pair : frequencies) {
+    total += pair.second;
+  }
+
+  double entropy = 0;
+  for (auto pair : frequencies) {
+    double p = double(pair.second) / total;
+    entropy -= p * std::log2(p);
+  }
+
+  return entropy;
+}
+
+bool sample_looks_incompressible(const std::vector<Byte> &data,
+                                 uint32_t sample_size) {
+  // Sampling only pays off when it skips most of the block
+  if (!sample_size || data.size() < 4 * uint64_t(sample_size))
+    return false;
+
+  uint32_t chunk_size = sample_size / SAMPLE_CHUNKS;
+  uint64_t chunk_stride = data.size() / SAMPLE_CHUNKS;
+
+  std::vector<Byte> sample;
+  sample.reserve(sample_size);
+  for (uint32_t i = 0; i < SAMPLE_CHUNKS; ++i) {
+    auto chunk = data.begin() + i * chunk_stride;
+    sample.insert(sample.end(), chunk, chunk + chunk_size);
+  }
+
+  return shannon_entropy(count_frequencies(sample)) > INCOMPRESSIBLE_ENTROPY;
+}
+
+// rANS
+
+std::map<Byte, uint32_t>
+normalize_frequencies(const std::map<Byte, uint32_t> &frequencies,
+                      uint32_t raw_size) {
+  StageTimer timer(STAGE_TABLE);
+
+  // Scale to RANS_SCALE keeping every symbol codable, then move the rounding
+  // error onto the largest frequencies where it costs the least
+  std::map<Byte, uint32_t> normalized;
+  int64_t total = 0;
+  for (auto pair : frequencies) {
+    uint32_t frequency = std::max<uint64_t>(
+        1, uint64_t(pair.second) * RANS_SCALE / raw_size);
+    normalized[pair.first] = frequency;
+    total += frequency;
+  }
+
+  while (total != RANS_SCALE) {
+    auto largest = normalized.begin();
+    for (auto it = normalized.begin(); it != normalized.end(); ++it) {
+      if (it->second > largest->second)
+        largest = it;
+    }
+
+    if (total > RANS_SCALE) {
+      uint32_t excess = std::min<int64_t>(total - RANS_SCALE,
+                                          largest->second / 2);
+      largest->second -= excess;
+      total -= excess;
+    } else {
+      largest->second += RANS_SCALE - total;
+      total = RANS_SCALE;
+    }
+  }
+
+  return normalized;
+}
+
+// Symbols go in backwards and the stream is written backwards from end, so
+// the decoder reads both forwards. Without Write only the bytes the stream
+// takes are counted, which runs the same state updates
+template <bool Write>
+size_t rans_encode_stream(const std::vector<Byte> &data,
+                          const std::map<Byte, uint32_t> &normalized,
+                          Byte *end) {
+  uint32_t frequency[UCHAR_MAX + 1] = {}, start[UCHAR_MAX + 1] = {};
+  uint32_t cumulative = 0;
+  for (auto pair : normalized) {
+    frequency[pair.first] = pair.second;
+    start[pair.first] = cumulative;
+    cumulative += pair.second;
+  }
+
+  size_t size = 0;
+  uint32_t states[RANS_STATES];
+  std::fill(states, states + RANS_STATES, RANS_LOWER_BOUND);
+
+  for (size_t i = data.size(); i-- > 0;) {
+    uint32_t &state = states[i % RANS_STATES];
+    uint32_t symbol_frequency = frequency[data[i]];
+
+    uint32_t state_max =
+        ((RANS_LOWER_BOUND >> RANS_SCALE_BITS) << CHAR_BIT) * symbol_frequency;
+    while (state >= state_max) {
+      ++size;
+      if (Write)
+        end[-ptrdiff_t(size)] = Byte(state);
+      state >>= CHAR_BIT;
+    }
+
+    state = ((state / symbol_frequency) << RANS_SCALE_BITS) +
+            state % symbol_frequency + start[data[i]];
+  }
+
+  for (uint32_t i = RANS_STATES; i-- > 0;) {
+    size += sizeof(uint32_t);
+    if (Write)
+      std::memcpy(end - size, &states[i], sizeof(uint32_t));
+  }
+
+  return size;
+}
+
+bool rans_can_win(const std::map<Byte, uint32_t> &frequencies,
+                  const std::map<Byte, uint32_t> &normalized,
+                  uint64_t data_size) {
+  double encoded_bits = 0;
+  for (auto pair : frequencies) {
+    encoded_bits += pair.second * std::log2(double(RANS_SCALE) /
+                                            normalized.at(pair.first));
+  }
+
+  uint64_t entropy_size = RANS_SYMBOLS_SIZE_FIELD +
+                          RANS_FREQUENCY_ENTRY_SIZE * normalized.size() +
+                          uint64_t(std::ceil(encoded_bits / CHAR_BIT)) +
+                          RANS_STATES * sizeof(uint32_t);
+  return entropy_size - (entropy_size >> RANS_ENTROPY_MARGIN_SHIFT) < data_size;
+}
+
+uint64_t rans_data_size(const std::vector<Byte> &data,
+                        const std::map<Byte, uint32_t> &normalized) {
+  StageTimer timer(STAGE_ENCODE);
+
+  return RANS_SYMBOLS_SIZE_FIELD +
+         RANS_FREQUENCY_ENTRY_SIZE * normalized.size() +
+         rans_encode_stream<false>(data, normalized, nullptr);
+}
+
+std::vector<Byte> rans_encode(const std::vector<Byte> &data,
+                              const std::map<Byte, uint32_t> &normalized) {
+  StageTimer timer(STAGE_ENCODE, data.size());
+
+  // A symbol never takes more than RANS_SCALE_BITS bits
+  std::vector<Byte> stream(2 * data.size() + RANS_STATES * sizeof(uint32_t));
+  Byte *end = stream.data() + stream.size();
+  size_t size = rans_encode_stream<true>(data, normalized, end);
+
+  return std::vector<Byte>(end - size, end);
+}
+
+std::vector<Byte> rans_decode(const std::vector<Byte> &bytes,
+                              uint32_t raw_size,
+                              const std::map<Byte, uint32_t> &normalized) {
+  // One lookup turns the low bits of a state into its symbol
+  Byte slot_symbol[RANS_SCALE];
+  uint32_t frequency[UCHAR_MAX + 1] = {}, start[UCHAR_MAX + 1] = {};
+  {
+    StageTimer timer(STAGE_TABLE);
+
+    uint32_t cumulative = 0;
+    for (auto pair : normalized) {
+      frequency[pair.first] = pair.second;
+      start[pair.first] = cumulative;
+      std::memset(slot_symbol + cumulative, pair.first, pair.second);
+      cumulative += pair.second;
+    }
+  }
+
+  StageTimer timer(STAGE_DECODE, raw_size);
+
+  std::vector<Byte> decoded(raw_size);
+
+  // A corrupt stream reads zeros past its end instead of overrunning it
+  const Byte *cursor = bytes.data();
+  const Byte *end = cursor + bytes.size();
+
+  uint32_t states[RANS_STATES];
+  for (uint32_t i = 0; i < RANS_STATES; ++i) {
+    if (!get_value(cursor, end, states[i]) || states[i] < RANS_LOWER_BOUND)
+      states[i] = RANS_LOWER_BOUND;
+  }
+
+  for (uint32_t i = 0; i < raw_size; ++i) {
+    uint32_t &state = states[i % RANS_STATES];
+    uint32_t slot = state & (RANS_SCALE - 1);
+    Byte symbol = slot_symbol[slot];
+    decoded[i] = symbol;
+
+    state = frequency[symbol] * (state >> RANS_SCALE_BITS) + slot -
+            start[symbol];
+    while (state < RANS_LOWER_BOUND) {
+      state = (state << CHAR_BIT) | (cursor < end ? *cursor++ : 0);
+    }
+  }
+
+  return decoded;
+}
+
+// Word Huffman
+
+bool is_word_byte(Byte ch) {
+  // Bytes of multibyte UTF-8 sequences count as letters
+  return std::isalnum(ch) || ch == '_' || ch > 0x7f;
+}
+
+bool is_space_byte(Byte ch) {
+  return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r';
+}
+
+WordModel build_word_model(const std::vector<Byte> &data,
+                           bool optimal_lengths) {
+  WordModel model;
+
+  // Tokens are runs of word bytes, runs of whitespace and single bytes of
+  // anything else, only tokens longer than a byte can become words
+  std::vector<std::pair<uint32_t, uint32_t>> tokens;
+  std::unordered_map<std::string, uint32_t> counts;
+  {
+    StageTimer timer(STAGE_HISTOGRAM);
+
+    for (size_t i = 0; i < data.size();) {
+      size_t end = i + 1;
+      if (is_word_byte(data[i])) {
+        while (end < data.size() && end - i < WORD_MAX_LENGTH &&
+               is_word_byte(data[end]))
+          ++end;
+      } else if (is_space_byte(data[i])) {
+        while (end < data.size() && end - i < WORD_MAX_LENGTH &&
+               is_space_byte(data[end]))
+          ++end;
+      }
+
+      tokens.emplace_back(i, end - i);
+      if (end - i > 1)
+        counts[std::string(data.begin() + i, data.begin() + end)]++;
+      i = end;
+    }
+  }
+
+  StageTimer timer(STAGE_TABLE);
+
+  // Keep the tokens that save the most bytes when the vocabulary is full,
+  // then sort it so the header can front code it
+  std::vector<std::pair<uint64_t, std::string>> candidates;
+  for (auto &pair : counts) {
+    if (pair.second >= WORD_MIN_COUNT)
+      candidates.emplace_back(uint64_t(pair.second) * (pair.first.length() - 1),
+                              pair.first);
+  }
+  if (candidates.size() > WORD_VOCABULARY_LIMIT) {
+    std::nth_element(candidates.begin(),
+                     candidates.begin() + WORD_VOCABULARY_LIMIT,
+                     candidates.end(), std::greater<>());
+    candidates.resize(WORD_VOCABULARY_LIMIT);
+  }
+  for (auto &candidate : candidates) {
+    model.vocabulary.push_back(std::move(candidate.second));
+  }
+  std::sort(model.vocabulary.begin(), model.vocabulary.end());
+
+  std::unordered_map<std::string, uint32_t> word_symbols;
+  for (uint32_t i = 0; i < model.vocabulary.size(); ++i) {
+    word_symbols[model.vocabulary[i]] = WORD_FIRST_SYMBOL + i;
+  }
+
+  // Escape every other token to its bytes
+  model.symbols.reserve(tokens.size());
+  for (auto token : tokens) {
+    auto begin = data.begin() + token.first;
+    auto word = token.second > 1
+                    ? word_symbols.find(std::string(begin, begin + token.second))
+                    : word_symbols.end();
+    if (word != word_symbols.end()) {
+      model.symbols.push_back(word->second);
+    } else {
+      model.symbols.insert(model.symbols.end(), begin, begin + token.second);
+    }
+  }
+
+  model.counts.assign(WORD_FIRST_SYMBOL + model.vocabulary.size(), 0);
+  for (uint32_t symbol : model.symbols) {
+    model.counts[symbol]++;
+  }
+  model.code_lengths =
+      limited_code_lengths(model.counts, MAX_CODE_LENGTH, optimal_lengths);
+
+  return model;
+}
+
+uint64_t word_data_size(const WordModel &model) {
+  uint64_t size = VOCABULARY_SIZE_FIELD;
+  for (size_t i = 0; i < model.vocabulary.size(); ++i) {
+    size_t shared = 0;
+    if (i > 0) {
+      const std::string &previous = model.vocabulary[i - 1];
+      while (shared < previous.length() &&
+             previous[shared] == model.vocabulary[i][shared])
+        ++shared;
+    }
+    size += 2 * sizeof(Byte) + model.vocabulary[i].length() - shared;
+  }
+
+  // The lengths are stored in whichever form serialize_word_table picks
+  size += WORD_LENGTHS_FORM_FIELD +
+          std::min<uint64_t>(listed_lengths_size(model.code_lengths),
+                             pack_code_lengths(model.code_lengths).size());
+  return size +
+         (canonical_bits(model.counts, model.code_lengths, SYMBOLS_8) +
+          CHAR_BIT - 1) /
+             CHAR_BIT;
+}
+
+void encode_word_symbols(const std::vector<uint32_t> &symbols,
+                         const std::vector<Byte> &lengths,
+                         const uint32_t *codes, BitWriter &writer) {
+  for (uint32_t symbol : symbols) {
+    writer.put(codes[symbol], lengths[symbol]);
+  }
+  writer.flush();
+}
+
+std::vector<Byte> encode_words(const WordModel &model) {
+  std::vector<uint32_t> codes;
+  {
+    StageTimer timer(STAGE_TABLE);
+    codes = canonical_codes(model.code_lengths);
+  }
+
+  StageTimer timer(STAGE_ENCODE);
+
+  BitWriter writer;
+  writer.bytes.reserve(model.symbols.size());
+  ISA_KERNEL(encode_word_symbols)(model.symbols, model.code_lengths,
+                                  codes.data(), writer);
+
+  return writer.bytes;
+}
+
+template <uint32_t TableBits, bool LongCodes>
+void decode_word_symbols(const Block &block, const DecodeEntry *table,
+                         const uint32_t *token_starts, const Byte *token_bytes,
+                         Byte *begin, Byte *end) {
+  // A refill leaves at least 57 bits, enough for this many codes
+  const uint32_t batch = 57 / (LongCodes ? MAX_CODE_LENGTH : TableBits);
+
+  // A token longer than what is left only comes up in corrupt blocks, it is
+  // cut off at the end
+  BitReader reader(block.data);
+  Byte *out = begin;
+  auto put_symbol = [&]() {
+    uint32_t symbol = lookup_symbol<TableBits, LongCodes>(table, reader);
+    if (symbol < WORD_FIRST_SYMBOL) {
+      *out++ = Byte(symbol);
+    } else {
+      uint32_t start = token_starts[symbol - WORD_FIRST_SYMBOL];
+      size_t length = std::min<size_t>(
+          token_starts[symbol - WORD_FIRST_SYMBOL + 1] - start, end - out);
+      std::memcpy(out, token_bytes + start, length);
+      out += length;
+    }
+  };
+
+  // A token writes at most WORD_MAX_LENGTH bytes, so whole batches fit while
+  // this many are left. The tail goes one symbol per refill
+  while (end - out >= ptrdiff_t(batch * WORD_MAX_LENGTH)) {
+    reader.refill();
+    for (uint32_t i = 0; i < batch; ++i) {
+      put_symbol();
+    }
+  }
+  while (out < end) {
+    reader.refill();
+    put_symbol();
+  }
+}
+
+std::vector<Byte> decode_words(const Block &block) {
+  // The vocabulary is laid out back to back, so a token is one copy
+  std::vector<DecodeEntry> table = build_decode_table(block.code_lengths);
+  std::vector<uint32_t> token_starts = {0};
+  std::vector<Byte> token_bytes;
+  {
+    StageTimer timer(STAGE_TABLE);
+    for (const std::string &word : block.vocabulary) {
+      token_bytes.insert(token_bytes.end(), word.begin(), word.end());
+      token_starts.push_back(token_bytes.size());
+    }
+  }
+
+  StageTimer timer(STAGE_DECODE, block.raw_size);
+
+  static const WordDecodeKernel kernels[DECODE_KERNEL_VARIANTS] = {
+      ISA_KERNEL(decode_word_symbols<9, false>),
+      ISA_KERNEL(decode_word_symbols<10, false>),
+      ISA_KERNEL(decode_word_symbols<11, false>),
+      ISA_KERNEL(decode_word_symbols<11, true>)};
+  uint32_t variant =
+      table.size() > 1u << DECODE_TABLE_BITS
+          ? DECODE_KERNEL_VARIANTS - 1
+          : decode_table_bits(table.size()) - MIN_DECODE_TABLE_BITS;
+
+  std::vector<Byte> decoded(block.raw_size);
+  kernels[variant](block, table.data(), token_starts.data(),
+                   token_bytes.data(), decoded.data(),
+                   decoded.data() + decoded.size());
+  return decoded;
+}
+
+// Canonical Huffman
+
+uint32_t alphabet_size(Byte symbol_width, size_t pairs) {
+  if (symbol_width == SYMBOLS_16)
+    return UINT16_MAX + 1;
+  if (symbol_width == SYMBOLS_RUNS)
+    return UCHAR_MAX + 1 + RUN_SYMBOLS;
+  return UCHAR_MAX + 1 + pairs;
+}
+
+uint32_t run_length(const Byte *begin, const Byte *end) {
+  // Length of the run of *begin starting at begin
+  const Byte *cursor = begin + 1;
+#ifdef __SSE2__
+  __m128i repeated = _mm_set1_epi8(char(*begin));
+  while (end - cursor >= 16) {
+    __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(cursor));
+    uint32_t equal = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, repeated));
+    if (equal != 0xffff)
+      return cursor - begin + __builtin_ctz(~equal);
+    cursor += 16;
+  }
+#endif
+  while (cursor < end && *cursor == *begin)
+    ++cursor;
+  return cursor - begin;
+}
+
+uint32_t literal_length(const Byte *begin, const Byte *end) {
+  // Bytes from begin up to the first one equal to the byte after it
+  const Byte *cursor = begin;
+#ifdef __SSE2__
+  while (end - cursor > 16) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(cursor));
+    __m128i next =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(cursor + 1));
+    uint32_t equal = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, next));
+    if (equal)
+      return cursor - begin + __builtin_ctz(equal);
+    cursor += 16;
+  }
+#endif
+  while (cursor + 1 < end && cursor[0] != cursor[1])
+    ++cursor;
+  return (cursor + 1 < end ? cursor : end) - begin;
+}
+
+uint64_t run_bytes(const std::vector<Byte> &data) {
+  StageTimer timer(STAGE_HISTOGRAM);
+
+  // Bytes that would be covered by run symbols
+  uint64_t covered = 0;
+  const Byte *end = data.data() + data.size();
+  for (const Byte *cursor = data.data(); cursor < end;) {
+    cursor += literal_length(cursor, end);
+    if (cursor == end)
+      break;
+
+    uint32_t length = run_length(cursor, end);
+    if (length > RUN_MIN_REPEAT)
+      covered += length - 1;
+    cursor += length;
+  }
+  return covered;
+}
+
+std::vector<std::pair<Byte, Byte>> choose_pairs(const std::vector<Byte> &data) {
+  StageTimer timer(STAGE_HISTOGRAM);
+
+  std::vector<uint32_t> counts(UINT16_MAX + 1);
+  for (size_t i = 0; i + 1 < data.size(); ++i) {
+    counts[data[i] << CHAR_BIT | data[i + 1]]++;
+  }
+
+  std::vector<std::pair<uint32_t, uint16_t>> candidates;
+  for (uint32_t pair = 0; pair <= UINT16_MAX; ++pair) {
+    if (counts[pair] >= PAIR_MIN_COUNT)
+      candidates.emplace_back(counts[pair], pair);
+  }
+  if (candidates.size() > PAIR_LIMIT) {
+    std::nth_element(candidates.begin(), candidates.begin() + PAIR_LIMIT,
+                     candidates.end(), std::greater<>());
+    candidates.resize(PAIR_LIMIT);
+  }
+  std::sort(candidates.begin(), candidates.end(),
+            [](const std::pair<uint32_t, uint16_t> &l,
+               const std::pair<uint32_t, uint16_t> &r) {
+              return l.second < r.second;
+            });
+
+  std::vector<std::pair<Byte, Byte>> pairs;
+  for (auto candidate : candidates) {
+    pairs.emplace_back(candidate.second >> CHAR_BIT, Byte(candidate.second));
+  }
+  return pairs;
+}
+
+std::vector<uint16_t>
+pair_symbols(const std::vector<std::pair<Byte, Byte>> &pairs) {
+  std::vector<uint16_t> symbols(UINT16_MAX + 1, NO_PAIR);
+  for (size_t i = 0; i < pairs.size(); ++i) {
+    symbols[pairs[i].first << CHAR_BIT | pairs[i].second] =
+        UCHAR_MAX + 1 + i;
+  }
+  return symbols;
+}
+
+// Calls emit with every symbol of data and the extra bits that follow it,
+// pairs are taken greedily from the left
+template <typename Emit>
+void for_each_symbol(const std::vector<Byte> &data, Byte symbol_width,
+                     const std::vector<uint16_t> &pair_table, Emit emit) {
+  size_t i = 0;
+  if (symbol_width == SYMBOLS_8) {
+    for (; i < data.size(); ++i) {
+      emit(data[i], 0, 0);
+    }
+  } else if (symbol_width == SYMBOLS_16) {
+    for (; i + 1 < data.size(); i += 2) {
+      emit(data[i] | data[i + 1] << CHAR_BIT, 0, 0);
+    }
+    // An odd trailing byte is coded zero extended
+    if (i < data.size())
+      emit(data[i], 0, 0);
+  } else if (symbol_width == SYMBOLS_RUNS) {
+    const Byte *end = data.data() + data.size();
+    while (i < data.size()) {
+      for (uint32_t literals = literal_length(data.data() + i, end); literals;
+           --literals) {
+        emit(data[i++], 0, 0);
+      }
+      if (i == data.size())
+        break;
+
+      uint32_t length = run_length(data.data() + i, end);
+      emit(data[i], 0, 0);
+      i += length;
+
+      uint32_t repeats = length - 1;
+      if (repeats < RUN_MIN_REPEAT) {
+        for (; repeats; --repeats) {
+          emit(data[i - repeats], 0, 0);
+        }
+        continue;
+      }
+
+      uint32_t value = repeats - RUN_MIN_REPEAT + 1;
+      uint32_t extra_bits = 31 - __builtin_clz(value);
+      emit(UCHAR_MAX + 1 + extra_bits, value - (1u << extra_bits), extra_bits);
+    }
+  } else {
+    while (i < data.size()) {
+      uint16_t pair = i + 1 < data.size()
+                          ? pair_table[data[i] << CHAR_BIT | data[i + 1]]
+                          : NO_PAIR;
+      if (pair != NO_PAIR) {
+        emit(pair, 0, 0);
+        i += 2;
+      } else {
+        emit(data[i], 0, 0);
+        ++i;
+      }
+    }
+  }
+}
+
+std::vector<uint32_t> count_symbols(const std::vector<Byte> &data,
+                                    Byte symbol_width,
+                                    const std::vector<std::pair<Byte, Byte>> &pairs) {
+  StageTimer timer(STAGE_HISTOGRAM);
+
+  std::vector<uint32_t> counts(alphabet_size(symbol_width, pairs.size()));
+  std::vector<uint16_t> pair_table;
+  if (symbol_width == SYMBOLS_PAIRS)
+    pair_table = pair_symbols(pairs);
+
+  for_each_symbol(data, symbol_width, pair_table,
+                  [&](uint32_t symbol, uint32_t, uint32_t) { counts[symbol]++; });
+  return counts;
+}
+
+void tree_code_lengths(HuffmanNode *node, Byte depth,
+                       std::vector<Byte> &lengths) {
+  if (!node->left) {
+    // A tree of a single leaf still needs a 1 bit code
+    lengths[node->symbol] = std::max<Byte>(depth, 1);
+    return;
+  }
+
+  tree_code_lengths(node->left, depth + 1, lengths);
+  tree_code_lengths(node->right, depth + 1, lengths);
+}
+
+std::vector<Byte> limited_code_lengths(const std::vector<uint32_t> &counts,
+                                       uint32_t max_length, bool optimal) {
+  std::vector<Byte> lengths(counts.size());
+
+  std::map<uint32_t, uint32_t> frequencies;
+  for (uint32_t symbol = 0; symbol < counts.size(); ++symbol) {
+    if (counts[symbol])
+      frequencies[symbol] = counts[symbol];
+  }
+  if (frequencies.empty())
+    return lengths;
+
+  HuffmanNode *root = build_huffman_tree(frequencies);
+  StageTimer timer(STAGE_TREE);
+  tree_code_lengths(root, 0, lengths);
+  delete_huffman_tree(root);
+
+  // Clamp long codes to max_length and lengthen the deepest shorter codes
+  // until the Kraft sum fits again, then hand the lengths back out with the
+  // shortest going to the most frequent symbols
+  uint32_t length_counts[MAX_CODE_LENGTH + 1] = {};
+  uint64_t kraft = 0;
+  bool clamped = false;
+  for (Byte &length : lengths) {
+    if (!length)
+      continue;
+    if (length > max_length) {
+      length = max_length;
+      clamped = true;
+    }
+    length_counts[length]++;
+    kraft += uint64_t(1) << (max_length - length);
+  }
+  if (!clamped)
+    return lengths;
+
+  if (optimal) {
+    package_merge_lengths(counts, max_length, lengths);
+    return lengths;
+  }
+
+  while (kraft > uint64_t(1) << max_length) {
+    uint32_t length = max_length - 1;
+    while (!length_counts[length])
+      --length;
+    length_counts[length]--;
+    length_counts[length + 1]++;
+    kraft -= uint64_t(1) << (max_length - length - 1);
+  }
+
+  std::vector<uint32_t> by_frequency;
+  for (auto pair : frequencies) {
+    by_frequency.push_back(pair.first);
+  }
+  std::stable_sort(by_frequency.begin(), by_frequency.end(),
+                   [&](uint32_t l, uint32_t r) { return counts[l] > counts[r]; });
+
+  uint32_t length = 1;
+  for (uint32_t symbol : by_frequency) {
+    while (!length_counts[length])
+      ++length;
+    lengths[symbol] = length;
+    length_counts[length]--;
+  }
+
+  return lengths;
+}
+
+void package_merge_lengths(const std::vector<uint32_t> &counts,
+                           uint32_t max_length, std::vector<Byte> &lengths) {
+  StageTimer timer(STAGE_TREE);
+
+  std::vector<uint32_t> symbols;
+  for (uint32_t symbol = 0; symbol < counts.size(); ++symbol) {
+    if (counts[symbol])
+      symbols.push_back(symbol);
+  }
+  std::stable_sort(symbols.begin(), symbols.end(),
+                   [&](uint32_t l, uint32_t r) { return counts[l] < counts[r]; });
+
+  // Every level merges the symbols with the pairs of the level below, from
+  // the deepest up, and only remembers which of its items are symbols
+  std::vector<std::vector<bool>> is_symbol(max_length);
+  std::vector<uint64_t> below, merged;
+  for (uint32_t level = 0; level < max_length; ++level) {
+    merged.clear();
+    size_t next_symbol = 0, next_pair = 0;
+    while (next_symbol < symbols.size() || next_pair + 1 < below.size()) {
+      bool take_symbol =
+          next_symbol < symbols.size() &&
+          (next_pair + 1 >= below.size() ||
+           counts[symbols[next_symbol]] <= below[next_pair] + below[next_pair + 1]);
+      is_symbol[level].push_back(take_symbol);
+      if (take_symbol) {
+        merged.push_back(counts[symbols[next_symbol++]]);
+      } else {
+        merged.push_back(below[next_pair] + below[next_pair + 1]);
+        next_pair += 2;
+      }
+    }
+    below.swap(merged);
+  }
+
+  // The cheapest 2n - 2 items of the top level make the code, every symbol
+  // among the items taken on a level adds a bit to its length, and every pair
+  // takes two items of the level below
+  std::fill(lengths.begin(), lengths.end(), 0);
+  size_t taken = 2 * symbols.size() - 2;
+  for (uint32_t level = max_length; level-- > 0;) {
+    size_t taken_symbols = 0;
+    for (size_t i = 0; i < taken; ++i) {
+      taken_symbols += is_symbol[level][i];
+    }
+    for (size_t i = 0; i < taken_symbols; ++i) {
+      lengths[symbols[i]]++;
+    }
+    taken = 2 * (taken - taken_symbols);
+  }
+}
+
+std::vector<uint32_t> canonical_codes(const std::vector<Byte> &lengths) {
+  // Codes of every length are consecutive, in symbol order
+  uint32_t length_counts[MAX_CODE_LENGTH + 1] = {};
+  for (Byte length : lengths) {
+    length_counts[length]++;
+  }
+  length_counts[0] = 0;
+
+  uint32_t next_code[MAX_CODE_LENGTH + 1] = {};
+  for (uint32_t length = 1; length <= MAX_CODE_LENGTH; ++length) {
+    next_code[length] = (next_code[length - 1] + length_counts[length - 1])
+                        << 1;
+  }
+
+  std::vector<uint32_t> codes(lengths.size());
+  for (uint32_t symbol = 0; symbol < lengths.size(); ++symbol) {
+    if (lengths[symbol])
+      codes[symbol] = next_code[lengths[symbol]]++;
+  }
+  return codes;
+}
+
+uint64_t canonical_bits(const std::vector<uint32_t> &counts,
+                        const std::vector<Byte> &lengths, Byte symbol_width) {
+  // UINT64_MAX when a symbol that occurs has no code
+  uint64_t encoded_bits = 0;
+  for (uint32_t symbol = 0; symbol < counts.size(); ++symbol) {
+    if (counts[symbol] && !lengths[symbol])
+      return UINT64_MAX;
+    encoded_bits += uint64_t(counts[symbol]) * lengths[symbol];
+  }
+
+  // Run symbol k carries k extra bits
+  if (symbol_width == SYMBOLS_RUNS) {
+    for (uint32_t k = 0; k < RUN_SYMBOLS; ++k) {
+      encoded_bits += uint64_t(counts[UCHAR_MAX + 1 + k]) * k;
+    }
+  }
+
+  return encoded_bits;
+}
+
+uint64_t canonical_data_size(const std::vector<uint32_t> &counts,
+                             const std::vector<Byte> &lengths,
+                             Byte symbol_width, size_t pairs) {
+  uint64_t size =
+      SYMBOL_WIDTH_FIELD + std::min<uint64_t>(listed_lengths_size(lengths),
+                                              pack_code_lengths(lengths).size());
+  if (symbol_width == SYMBOLS_PAIRS)
+    size += PAIRS_SIZE_FIELD + 2 * pairs;
+
+  return size +
+         (canonical_bits(counts, lengths, symbol_width) + CHAR_BIT - 1) /
+             CHAR_BIT;
+}
+
+uint64_t plan_canonical_block(const std::vector<Byte> &data,
+                              const std::map<Byte, uint32_t> &frequencies,
+                              const CompressionLevel &level, Block &block) {
+  SymbolWidth symbol_width = level.symbols;
+  std::vector<uint32_t> counts(UCHAR_MAX + 1);
+  for (auto pair : frequencies) {
+    counts[pair.first] = pair.second;
+  }
+
+  block.symbol_width = SYMBOLS_8;
+  block.table_mode = TABLE_STORED;
+  block.pairs.clear();
+  block.code_lengths =
+      limited_code_lengths(counts, MAX_CODE_LENGTH, level.optimal_lengths);
+  uint64_t size =
+      canonical_data_size(counts, block.code_lengths, SYMBOLS_8, 0);
+
+  // Small blocks can do without a table of their own
+  if (data.size() <= STATIC_MAX_SIZE) {
+    Block builtin;
+    uint64_t builtin_size = plan_builtin_block(counts.data(), builtin);
+    if (builtin_size < size) {
+      block.table_mode = TABLE_BUILTIN;
+      block.table_index = builtin.table_index;
+      block.table_id = builtin.table_id;
+      block.code_lengths = std::move(builtin.code_lengths);
+      size = builtin_size;
+    }
+  }
+
+  // Runs are counted only when a quick scan finds enough of them
+  if (data.size() > RUN_MIN_REPEAT &&
+      run_bytes(data) >= data.size() / RUN_MIN_SHARE) {
+    std::vector<uint32_t> run_counts = count_symbols(data, SYMBOLS_RUNS, {});
+    std::vector<Byte> lengths = limited_code_lengths(
+        run_counts, MAX_CODE_LENGTH, level.optimal_lengths);
+    uint64_t run_size =
+        canonical_data_size(run_counts, lengths, SYMBOLS_RUNS, 0);
+
+    if (run_size < size) {
+      block.symbol_width = SYMBOLS_RUNS;
+      block.table_mode = TABLE_STORED;
+      block.code_lengths = std::move(lengths);
+      size = run_size;
+    }
+  }
+
+  // Wider symbols only pay for their larger table when they take the size
+  // below that of bytes
+  if (symbol_width != SYMBOLS_8 && symbol_width != SYMBOLS_RUNS &&
+      data.size() > 1) {
+    std::vector<std::pair<Byte, Byte>> pairs;
+    if (symbol_width == SYMBOLS_PAIRS)
+      pairs = choose_pairs(data);
+
+    if (symbol_width == SYMBOLS_16 || !pairs.empty()) {
+      std::vector<uint32_t> wide_counts =
+          count_symbols(data, symbol_width, pairs);
+      std::vector<Byte> lengths = limited_code_lengths(
+          wide_counts, MAX_CODE_LENGTH, level.optimal_lengths);
+      uint64_t wide_size = canonical_data_size(wide_counts, lengths,
+                                               symbol_width, pairs.size());
+
+      if (wide_size < size) {
+        block.symbol_width = symbol_width;
+        block.table_mode = TABLE_STORED;
+        block.pairs = std::move(pairs);
+        block.code_lengths = std::move(lengths);
+        size = wide_size;
+      }
+    }
+  }
+
+  return size;
+}
+
+uint64_t plan_builtin_block(const uint32_t *counts, Block &block) {
+  uint64_t best_bits = UINT64_MAX;
+  for (Byte index = 0; index < STATIC_TABLES; ++index) {
+    uint64_t bits = 0;
+    for (uint32_t byte = 0; byte <= UCHAR_MAX; ++byte) {
+      bits += uint64_t(counts[byte]) * STATIC_CODE_LENGTHS[index][byte];
+    }
+    if (bits < best_bits) {
+      best_bits = bits;
+      block.table_index = index;
+    }
+  }
+
+  block.symbol_width = SYMBOLS_8;
+  block.table_mode = TABLE_BUILTIN;
+  block.table_id = BUILTIN_TABLES[block.table_index].id;
+  block.pairs.clear();
+  block.code_lengths.assign(STATIC_CODE_LENGTHS[block.table_index],
+                            STATIC_CODE_LENGTHS[block.table_index] + UCHAR_MAX +
+                                1);
+  return SYMBOL_WIDTH_FIELD + TABLE_INDEX_FIELD + STATIC_TABLE_ID_FIELD +
+         (best_bits + CHAR_BIT - 1) / CHAR_BIT;
+}
+
+void cache_table(TableCache &tables, CachedTable table) {
+  tables.push_front(std::move(table));
+  if (tables.size() > TABLE_CACHE_SIZE)
+    tables.pop_back();
+}
+
+void use_cached_table(TableCache &tables, size_t index) {
+  CachedTable table = std::move(tables[index]);
+  tables.erase(tables.begin() + index);
+  tables.push_front(std::move(table));
+}
+
+void choose_table(const std::vector<Byte> &data, Block &block,
+                  TableCache &tables, uint32_t reuse_tables, uint64_t &size) {
+  // Pair tables depend on the pairs of their block, they are neither shared
+  // nor cached, and neither are built-in tables. Without reuse nothing ever
+  // refers to the cache, so it need not be kept either
+  if (block.symbol_width == SYMBOLS_PAIRS ||
+      block.table_mode == TABLE_BUILTIN || !reuse_tables)
+    return;
+
+  std::vector<uint32_t> counts;
+  uint64_t own_bytes = 0;
+  for (size_t index = 0; index < std::min<size_t>(tables.size(), reuse_tables);
+       ++index) {
+    const CachedTable &cached = tables[index];
+    if (cached.symbol_width != block.symbol_width)
+      continue;
+
+    if (counts.empty()) {
+      if (block.symbol_width == SYMBOLS_8) {
+        counts.resize(UCHAR_MAX + 1);
+        count_bytes(data.data(), data.size(), counts.data());
+      } else {
+        counts = count_symbols(data, block.symbol_width, {});
+      }
+      own_bytes =
+          (canonical_bits(counts, block.code_lengths, block.symbol_width) +
+           CHAR_BIT - 1) /
+          CHAR_BIT;
+    }
+
+    uint64_t bits =
+        canonical_bits(counts, cached.code_lengths, block.symbol_width);
+    if (bits != UINT64_MAX) {
+      uint64_t reused_size = SYMBOL_WIDTH_FIELD + TABLE_INDEX_FIELD +
+                             (bits + CHAR_BIT - 1) / CHAR_BIT;
+      if (reused_size < size) {
+        block.table_mode = TABLE_REUSED;
+        block.table_index = index;
+        size = reused_size;
+      }
+    }
+
+    std::vector<std::pair<uint16_t, Byte>> changes;
+    for (uint32_t symbol = 0; symbol < block.code_lengths.size(); ++symbol) {
+      if (block.code_lengths[symbol] != cached.code_lengths[symbol])
+        changes.push_back({symbol, block.code_lengths[symbol]});
+    }
+    uint64_t delta_size = SYMBOL_WIDTH_FIELD + TABLE_INDEX_FIELD +
+                          LENGTHS_SIZE_FIELD +
+                          CODE_LENGTH_ENTRY_SIZE * changes.size() + own_bytes;
+    if (delta_size < size) {
+      block.table_mode = TABLE_DELTA;
+      block.table_index = index;
+      block.length_changes = std::move(changes);
+      size = delta_size;
+    }
+  }
+
+  // The cache changes the same way resolve_table changes it when decoding
+  if (block.table_mode == TABLE_REUSED) {
+    block.length_changes.clear();
+    block.code_lengths = tables[block.table_index].code_lengths;
+    use_cached_table(tables, block.table_index);
+  } else {
+    if (block.table_mode == TABLE_STORED)
+      block.length_changes.clear();
+    cache_table(tables, {block.symbol_width, block.code_lengths, {}});
+  }
+}
+
+void encode_symbols(const std::vector<Byte> &data, const Block &block,
+                    const uint32_t *codes,
+                    const std::vector<uint16_t> &pair_table,
+                    BitWriter &writer) {
+  for_each_symbol(data, block.symbol_width, pair_table,
+                  [&](uint32_t symbol, uint32_t extra, uint32_t extra_bits) {
+                    writer.put(codes[symbol], block.code_lengths[symbol]);
+                    writer.put(extra, extra_bits);
+                  });
+  writer.flush();
+}
+
+std::vector<Byte> canonical_encode(const std::vector<Byte> &data,
+                                   const Block &block) {
+  std::vector<uint32_t> own_codes;
+  const uint32_t *codes;
+  std::vector<uint16_t> pair_table;
+  {
+    StageTimer timer(STAGE_TABLE);
+    if (block.table_mode == TABLE_BUILTIN) {
+      codes = BUILTIN_TABLES[block.table_index].codes;
+    } else {
+      own_codes = canonical_codes(block.code_lengths);
+      codes = own_codes.data();
+    }
+    if (block.symbol_width == SYMBOLS_PAIRS)
+      pair_table = pair_symbols(block.pairs);
+  }
+
+  StageTimer timer(STAGE_ENCODE, data.size());
+
+  BitWriter writer;
+  writer.bytes.reserve(data.size());
+  ISA_KERNEL(encode_symbols)(data, block, codes, pair_table, writer);
+
+  return writer.bytes;
+}
+
+uint32_t decode_table_bits(size_t table_size) {
+  // Tables with second level tables index DECODE_TABLE_BITS bits
+  uint32_t bits = MIN_DECODE_TABLE_BITS;
+  while (bits < DECODE_TABLE_BITS && table_size > 1u << bits)
+    ++bits;
+  return bits;
+}
+
+uint32_t decode_symbol(const std::vector<DecodeEntry> &table,
+                       uint32_t table_bits, BitReader &reader) {
+  reader.refill();
+
+  DecodeEntry entry = table[reader.buffer >> (64 - table_bits)];
+  if (entry.subtable_bits) {
+    entry = table[entry.value + ((reader.buffer << table_bits) >>
+                                 (64 - entry.subtable_bits))];
+  }
+  reader.consume(entry.length);
+
+  return entry.value;
+}
+
+template <uint32_t TableBits, bool LongCodes>
+uint32_t lookup_symbol(const DecodeEntry *table, BitReader &reader) {
+  // The caller refills
+  DecodeEntry entry = table[reader.buffer >> (64 - TableBits)];
+  if (LongCodes && entry.subtable_bits) {
+    entry = table[entry.value + ((reader.buffer << TableBits) >>
+                                 (64 - entry.subtable_bits))];
+  }
+  reader.consume(entry.length);
+
+  return entry.value;
+}
+
+template <Byte SymbolWidth, uint32_t TableBits, bool LongCodes>
+void decode_symbols(const Block &block, const DecodeEntry *table, Byte *begin,
+                    Byte *end) {
+  // A refill leaves at least 57 bits, enough for this many codes. A run
+  // symbol reads its extra bits from the same refill, so runs go one by one
+  const uint32_t batch =
+      SymbolWidth == SYMBOLS_RUNS
+          ? 1
+          : 57 / (LongCodes ? MAX_CODE_LENGTH : TableBits);
+
+  BitReader reader(block.data);
+  Byte *out = begin;
+  auto put_symbol = [&]() {
+    uint32_t symbol = lookup_symbol<TableBits, LongCodes>(table, reader);
+    if (SymbolWidth == SYMBOLS_16) {
+      out[0] = Byte(symbol);
+      out[1] = Byte(symbol >> CHAR_BIT);
+      out += 2;
+    } else if (SymbolWidth == SYMBOLS_RUNS && symbol > UCHAR_MAX) {
+      uint32_t extra_bits = symbol - (UCHAR_MAX + 1);
+      uint32_t value = 1u << extra_bits;
+      if (extra_bits) {
+        value |= reader.buffer >> (64 - extra_bits);
+        reader.consume(extra_bits);
+      }
+
+      uint32_t repeats =
+          std::min<uint64_t>(value + RUN_MIN_REPEAT - 1, end - out);
+      std::memset(out, out > begin ? out[-1] : 0, repeats);
+      out += repeats;
+    } else if (SymbolWidth == SYMBOLS_PAIRS && symbol > UCHAR_MAX &&
+               symbol - (UCHAR_MAX + 1) < block.pairs.size()) {
+      out[0] = block.pairs[symbol - (UCHAR_MAX + 1)].first;
+      out[1] = block.pairs[symbol - (UCHAR_MAX + 1)].second;
+      out += 2;
+    } else {
+      *out++ = Byte(symbol);
+    }
+  };
+
+  // A symbol writes at most 2 bytes, so whole batches fit while this many
+  // are left. The tail goes one symbol per refill
+  while (end - out >= ptrdiff_t(2 * batch)) {
+    reader.refill();
+    for (uint32_t i = 0; i < batch; ++i) {
+      put_symbol();
+    }
+  }
+  while (out < end) {
+    reader.refill();
+    put_symbol();
+  }
+}
+
+uint32_t average_code_length(const DecodeEntry *table, size_t table_size) {
+  // Every first level entry stands for the same share of the codes the table
+  // was built for, so this is their average length in whole bits, rounded up.
+  // Codes in second level tables count as their longest
+  uint32_t table_bits = decode_table_bits(table_size);
+  uint64_t total = 0;
+  for (uint32_t index = 0; index < 1u << table_bits; ++index) {
+    total += table[index].subtable_bits
+                 ? table_bits + table[index].subtable_bits
+                 : table[index].length;
+  }
+
+  return (total + (1u << table_bits) - 1) >> table_bits;
+}
+
+std::vector<MultiDecodeEntry> build_multi_decode_table(const DecodeEntry *table,
+                                                       size_t table_size) {
+  StageTimer timer(STAGE_TABLE);
+
+  // Decode every index through the canonical table, taking codes while they
+  // end within it
+  uint32_t table_bits = decode_table_bits(table_size);
+  std::vector<MultiDecodeEntry> multi_table(1 << MULTI_DECODE_TABLE_BITS);
+  for (uint32_t index = 0; index < multi_table.size(); ++index) {
+    MultiDecodeEntry &multi = multi_table[index];
+    multi = {};
+    uint64_t bits = uint64_t(index) << (64 - MULTI_DECODE_TABLE_BITS);
+    while (multi.count < MULTI_DECODE_SYMBOLS) {
+      DecodeEntry entry = table[bits >> (64 - table_bits)];
+      if (entry.subtable_bits) {
+        entry = table[entry.value +
+                      ((bits << table_bits) >> (64 - entry.subtable_bits))];
+      }
+      if (multi.length + entry.length > MULTI_DECODE_TABLE_BITS)
+        break;
+
+      multi.symbols[multi.count++] = Byte(entry.value);
+      multi.length += entry.length;
+      bits <<= entry.length;
+    }
+  }
+
+  return multi_table;
+}
+
+template <uint32_t TableBits, bool LongCodes>
+void decode_multi_symbols(const Block &block, const DecodeEntry *table,
+                          const MultiDecodeEntry *multi_table, Byte *begin,
+                          Byte *end) {
+  // A refill leaves at least 57 bits, enough for this many lookups. A code
+  // longer than the index refills again before it goes through the canonical
+  // table, which leaves at least 57 - MAX_CODE_LENGTH bits for the rest of
+  // the batch
+  const uint32_t batch = 57 / MULTI_DECODE_TABLE_BITS;
+  static_assert((batch - 1) * MULTI_DECODE_TABLE_BITS <= 57 - MAX_CODE_LENGTH,
+                "a long code must leave room for the rest of the batch");
+
+  BitReader reader(block.data);
+  Byte *out = begin;
+
+  // Entries copy all their symbol bytes, whole batches fit while this many
+  // are left. The tail goes one symbol per refill
+  while (end - out >= ptrdiff_t(batch * MULTI_DECODE_SYMBOLS)) {
+    reader.refill();
+    for (uint32_t i = 0; i < batch; ++i) {
+      const MultiDecodeEntry &entry =
+          multi_table[reader.buffer >> (64 - MULTI_DECODE_TABLE_BITS)];
+      if (entry.count) {
+        std::memcpy(out, entry.symbols, MULTI_DECODE_SYMBOLS);
+        out += entry.count;
+        reader.consume(entry.length);
+      } else {
+        reader.refill();
+        *out++ = Byte(lookup_symbol<TableBits, LongCodes>(table, reader));
+      }
+    }
+  }
+  while (out < end) {
+    reader.refill();
+    *out++ = Byte(lookup_symbol<TableBits, LongCodes>(table, reader));
+  }
+}
+
+std::vector<DecodeEntry> build_decode_table(const std::vector<Byte> &lengths) {
+  StageTimer timer(STAGE_TABLE);
+
+  std::vector<uint32_t> codes = canonical_codes(lengths);
+
+  // The first level indexes as many bits as the longest code needs, within
+  // MIN_DECODE_TABLE_BITS and DECODE_TABLE_BITS
+  uint32_t table_bits = MIN_DECODE_TABLE_BITS;
+  for (Byte length : lengths) {
+    table_bits = std::max<uint32_t>(
+        table_bits, std::min<uint32_t>(length, DECODE_TABLE_BITS));
+  }
+
+  // Entries no code reaches only come up in corrupt blocks, they still
+  // consume a bit so decoding always moves on
+  std::vector<DecodeEntry> table(1 << table_bits, {0, 1, 0});
+
+  // Size the second level table of every prefix for its longest code
+  std::vector<Byte> subtable_bits(1 << table_bits);
+  for (uint32_t symbol = 0; symbol < lengths.size(); ++symbol) {
+    if (lengths[symbol] > table_bits) {
+      uint32_t extra_bits = lengths[symbol] - table_bits;
+      Byte &bits = subtable_bits[codes[symbol] >> extra_bits];
+      bits = std::max<Byte>(bits, extra_bits);
+    }
+  }
+  for (uint32_t prefix = 0; prefix < subtable_bits.size(); ++prefix) {
+    if (subtable_bits[prefix]) {
+      table[prefix] = {uint32_t(table.size()), 0, subtable_bits[prefix]};
+      table.resize(table.size() + (1 << subtable_bits[prefix]), {0, 1, 0});
+    }
+  }
+
+  for (uint32_t symbol = 0; symbol < lengths.size(); ++symbol) {
+    uint32_t length = lengths[symbol];
+    if (!length)
+      continue;
+
+    uint32_t first, count;
+    if (length <= table_bits) {
+      first = codes[symbol] << (table_bits - length);
+      count = 1 << (table_bits - length);
+    } else {
+      uint32_t extra_bits = length - table_bits;
+      const DecodeEntry &link = table[codes[symbol] >> extra_bits];
+      uint32_t suffix = codes[symbol] & ((1 << extra_bits) - 1);
+      first = link.value + (suffix << (link.subtable_bits - extra_bits));
+      count = 1 << (link.subtable_bits - extra_bits);
+    }
+
+    std::fill(table.begin() + first, table.begin() + first + count,
+              DecodeEntry{symbol, Byte(length), 0});
+  }
+
+  return table;
+}
+
+void resolve_table(const Block &block, TableCache &tables) {
+  if (block.table_mode == TABLE_STORED) {
+    cache_table(tables, {block.symbol_width, block.code_lengths,
+                         build_decode_table(block.code_lengths)});
+    return;
+  }
+
+  if (block.table_index >= tables.size() ||
+      tables[block.table_index].symbol_width != block.symbol_width)
+    exit_with_error("Corrupt block, it refers to a missing table");
+
+  if (block.table_mode == TABLE_REUSED) {
+    use_cached_table(tables, block.table_index);
+    return;
+  }
+
+  // The changed lengths still have to form a prefix code
+  std::vector<Byte> lengths = tables[block.table_index].code_lengths;
+  for (auto change : block.length_changes) {
+    if (change.first >= lengths.size())
+      exit_with_error("Corrupt block, it refers to a missing table");
+    lengths[change.first] = change.second;
+  }
+  uint64_t kraft = 0;
+  for (Byte length : lengths) {
+    if (length)
+      kraft += uint64_t(1) << (MAX_CODE_LENGTH - length);
+  }
+  if (kraft > uint64_t(1) << MAX_CODE_LENGTH)
+    exit_with_error("Corrupt block, its code lengths are no prefix code");
+
+  std::vector<DecodeEntry> decode_table = build_decode_table(lengths);
+  cache_table(tables,
+              {block.symbol_width, std::move(lengths), std::move(decode_table)});
+}
+
+std::vector<Byte> canonical_decode(const Block &block,
+                                   const DecodeEntry *table,
+                                   size_t table_size) {
+  StageTimer timer(STAGE_DECODE, block.raw_size);
+
+  // The symbol width and table shape pick the kernel once, so its loop has
+  // no branches on them
+  static const DecodeKernel kernels[SYMBOLS_RUNS + 1][DECODE_KERNEL_VARIANTS] =
+      {{ISA_KERNEL(decode_symbols<SYMBOLS_8, 9, false>),
+        ISA_KERNEL(decode_symbols<SYMBOLS_8, 10, false>),
+        ISA_KERNEL(decode_symbols<SYMBOLS_8, 11, false>),
+        ISA_KERNEL(decode_symbols<SYMBOLS_8, 11, true>)},
+       {ISA_KERNEL(decode_symbols<SYMBOLS_16, 9, false>),
+        ISA_KERNEL(decode_symbols<SYMBOLS_16, 10, false>),
+        ISA_KERNEL(decode_symbols<SYMBOLS_16, 11, false>),
+        ISA_KERNEL(decode_symbols<SYMBOLS_16, 11, true>)},
+       {ISA_KERNEL(decode_symbols<SYMBOLS_PAIRS, 9, false>),
+        ISA_KERNEL(decode_symbols<SYMBOLS_PAIRS, 10, false>),
+        ISA_KERNEL(decode_symbols<SYMBOLS_PAIRS, 11, false>),
+        ISA_KERNEL(decode_symbols<SYMBOLS_PAIRS, 11, true>)},
+       {ISA_KERNEL(decode_symbols<SYMBOLS_RUNS, 9, false>),
+        ISA_KERNEL(decode_symbols<SYMBOLS_RUNS, 10, false>),
+        ISA_KERNEL(decode_symbols<SYMBOLS_RUNS, 11, false>),
+        ISA_KERNEL(decode_symbols<SYMBOLS_RUNS, 11, true>)}};
+  static const MultiDecodeKernel multi_kernels[DECODE_KERNEL_VARIANTS] = {
+      ISA_KERNEL(decode_multi_symbols<9, false>),
+      ISA_KERNEL(decode_multi_symbols<10, false>),
+      ISA_KERNEL(decode_multi_symbols<11, false>),
+      ISA_KERNEL(decode_multi_symbols<11, true>)};
+  uint32_t variant =
+      table_size > 1u << DECODE_TABLE_BITS
+          ? DECODE_KERNEL_VARIANTS - 1
+          : decode_table_bits(table_size) - MIN_DECODE_TABLE_BITS;
+
+  // A symbol writes at most 2 bytes, the second one past the end of a block
+  // of odd size goes into the slack byte
+  std::vector<Byte> decoded(block.raw_size + 1);
+
+  // Building the multi symbol table only pays off over enough short codes
+  if (block.symbol_width == SYMBOLS_8 &&
+      block.raw_size >= MULTI_DECODE_MIN_SIZE &&
+      average_code_length(table, table_size) <= MULTI_DECODE_MAX_LENGTH) {
+    std::vector<MultiDecodeEntry> multi_table =
+        build_multi_decode_table(table, table_size);
+    multi_kernels[variant](block, table, multi_table.data(), decoded.data(),
+                           decoded.data() + block.raw_size);
+    decoded.resize(block.raw_size);
+    return decoded;
+  }
+
+  kernels[block.symbol_width][variant](block, table, decoded.data(),
+                                       decoded.data() + block.raw_size);
+
+  decoded.resize(block.raw_size);
+  return decoded;
+}
+
+// Burrows-Wheeler Transform
+
+std::vector<int32_t> suffix_array(const std::vector<int32_t> &text,
+                                  int32_t alphabet_size) {
+  // SA-IS, text has to end in a 0 that occurs nowhere else
+  int32_t n = text.size();
+  std::vector<int32_t> sa(n, -1);
+  if (n == 1) {
+    sa[0] = 0;
+    return sa;
+  }
+
+  // S type suffixes are smaller than the suffix after them, LMS suffixes are
+  // the S type ones right after an L type one
+  std::vector<bool> s_type(n);
+  s_type[n - 1] = true;
+  for (int32_t i = n - 2; i >= 0; --i) {
+    s_type[i] = text[i] < text[i + 1] ||
+                (text[i] == text[i + 1] && s_type[i + 1]);
+  }
+  auto is_lms = [&](int32_t i) { return i > 0 && s_type[i] && !s_type[i - 1]; };
+
+  std::vector<int32_t> bucket_sizes(alphabet_size), buckets(alphabet_size);
+  for (int32_t ch : text) {
+    bucket_sizes[ch]++;
+  }
+  auto bucket_heads = [&]() {
+    int32_t sum = 0;
+    for (int32_t ch = 0; ch < alphabet_size; ++ch) {
+      buckets[ch] = sum;
+      sum += bucket_sizes[ch];
+    }
+  };
+  auto bucket_tails = [&]() {
+    int32_t sum = 0;
+    for (int32_t ch = 0; ch < alphabet_size; ++ch) {
+      sum += bucket_sizes[ch];
+      buckets[ch] = sum;
+    }
+  };
+
+  // Places the LMS suffixes in the given order at the ends of their buckets,
+  // then induces the L and S type suffixes from them
+  auto induce = [&](const std::vector<int32_t> &lms) {
+    std::fill(sa.begin(), sa.end(), -1);
+    bucket_tails();
+    for (size_t i = lms.size(); i-- > 0;) {
+      sa[--buckets[text[lms[i]]]] = lms[i];
+    }
+    bucket_heads();
+    for (int32_t i = 0; i < n; ++i) {
+      int32_t j = sa[i] - 1;
+      if (sa[i] > 0 && !s_type[j])
+        sa[buckets[text[j]]++] = j;
+    }
+    bucket_tails();
+    for (int32_t i = n - 1; i >= 0; --i) {
+      int32_t j = sa[i] - 1;
+      if (sa[i] > 0 && s_type[j])
+        sa[--buckets[text[j]]] = j;
+    }
+  };
+
+  std::vector<int32_t> lms;
+  for (int32_t i = 1; i < n; ++i) {
+    if (is_lms(i))
+      lms.push_back(i);
+  }
+  induce(lms);
+
+  // Name the LMS substrings in their sorted order, equal substrings sharing
+  // a name
+  std::vector<int32_t> names(n, -1);
+  int32_t name = -1, previous = -1;
+  for (int32_t i = 0; i < n; ++i) {
+    int32_t current = sa[i];
+    if (!is_lms(current))
+      continue;
+
+    bool equal = previous >= 0;
+    for (int32_t k = 0; equal; ++k) {
+      bool current_end = k > 0 && is_lms(current + k);
+      bool previous_end = k > 0 && is_lms(previous + k);
+      if (current_end && previous_end)
+        break;
+      equal = current_end == previous_end &&
+              text[current + k] == text[previous + k] &&
+              s_type[current + k] == s_type[previous + k];
+    }
+    if (!equal)
+      ++name;
+    names[current] = name;
+    previous = current;
+  }
+
+  // Sort the LMS suffixes through the string of their names, recursing only
+  // while names repeat
+  std::vector<int32_t> reduced(lms.size());
+  for (size_t i = 0; i < lms.size(); ++i) {
+    reduced[i] = names[lms[i]];
+  }
+  names = std::vector<int32_t>();
+
+  std::vector<int32_t> reduced_sa(lms.size());
+  if (name + 1 == int32_t(lms.size())) {
+    for (size_t i = 0; i < lms.size(); ++i) {
+      reduced_sa[reduced[i]] = i;
+    }
+  } else {
+    reduced_sa = suffix_array(reduced, name + 1);
+  }
+
+  std::vector<int32_t> sorted_lms(lms.size());
+  for (size_t i = 0; i < lms.size(); ++i) {
+    sorted_lms[i] = lms[reduced_sa[i]];
+  }
+  induce(sorted_lms);
+
+  return sa;
+}
+
+uint32_t bwt_stream_size(uint32_t size) {
+  return (size + BWT_STREAMS - 1) / BWT_STREAMS;
+}
+
+std::vector<Byte> bwt_forward(const std::vector<Byte> &data,
+                              uint32_t start_rows[BWT_STREAMS]) {
+  StageTimer timer(STAGE_TRANSFORM, data.size());
+
+  // Bytes shift up by one for the terminating 0, whose row is left out of
+  // the output and recorded as the primary index
+  std::vector<int32_t> text(data.begin(), data.end());
+  for (int32_t &ch : text) {
+    ch++;
+  }
+  text.push_back(0);
+
+  std::vector<int32_t> sa = suffix_array(text, UCHAR_MAX + 2);
+
+  // Streams past the end of a tiny block start at the terminator row
+  uint32_t stream_size = bwt_stream_size(data.size());
+  std::fill(start_rows, start_rows + BWT_STREAMS, 0);
+
+  std::vector<Byte> bwt;
+  bwt.reserve(data.size());
+  for (uint32_t i = 0; i < sa.size(); ++i) {
+    if (uint32_t(sa[i]) < data.size() && sa[i] % stream_size == 0)
+      start_rows[sa[i] / stream_size] = i;
+    if (sa[i] != 0)
+      bwt.push_back(data[sa[i] - 1]);
+  }
+  return bwt;
+}
+
+std::vector<Byte> bwt_inverse(const std::vector<Byte> &bwt,
+                              const uint32_t start_rows[BWT_STREAMS]) {
+  StageTimer timer(STAGE_TRANSFORM, bwt.size());
+
+  // Rows are numbered with the terminator put back at the row of the whole
+  // block. Every entry packs the first byte of a row with the row that
+  // follows it in the text, so each step of a walk is a single random access
+  uint32_t primary_index = start_rows[0];
+  uint32_t starts[UCHAR_MAX + 1] = {};
+  for (Byte ch : bwt) {
+    starts[ch]++;
+  }
+  uint32_t sum = 1;
+  for (uint32_t &start : starts) {
+    uint32_t count = start;
+    start = sum;
+    sum += count;
+  }
+
+  std::vector<uint32_t> next(bwt.size() + 1);
+  next[0] = primary_index << CHAR_BIT;
+  for (uint32_t i = 0; i < bwt.size(); ++i) {
+    uint32_t row = i < primary_index ? i : i + 1;
+    next[starts[bwt[i]]++] = row << CHAR_BIT | bwt[i];
+  }
+
+  // All streams but the last are full, so they take their steps together
+  std::vector<Byte> data(bwt.size());
+  uint32_t stream_size = bwt_stream_size(bwt.size());
+  uint32_t full_streams = bwt.size() / stream_size;
+  uint32_t rows[BWT_STREAMS];
+  std::copy(start_rows, start_rows + BWT_STREAMS, rows);
+
+  for (uint32_t i = 0; i < stream_size; ++i) {
+    for (uint32_t stream = 0; stream < full_streams; ++stream) {
+      uint32_t entry = next[rows[stream]];
+      data[stream * stream_size + i] = Byte(entry);
+      rows[stream] = entry >> CHAR_BIT;
+    }
+  }
+  for (uint32_t i = full_streams * stream_size; i < bwt.size(); ++i) {
+    uint32_t entry = next[rows[full_streams]];
+    data[i] = Byte(entry);
+    rows[full_streams] = entry >> CHAR_BIT;
+  }
+  return data;
+}
+
+std::vector<uint16_t> mtf_encode(const std::vector<Byte> &data) {
+  StageTimer timer(STAGE_TRANSFORM, data.size());
+
+  Byte order[UCHAR_MAX + 1];
+  for (int i = 0; i <= UCHAR_MAX; ++i) {
+    order[i] = i;
+  }
+
+  std::vector<uint16_t> symbols;
+  uint32_t zeros = 0;
+  auto flush_zeros = [&]() {
+    // Bijective base 2, least significant digit first
+    while (zeros) {
+      --zeros;
+      symbols.push_back(zeros & 1 ? RUNB : RUNA);
+      zeros >>= 1;
+    }
+  };
+
+  for (Byte ch : data) {
+    if (order[0] == ch) {
+      ++zeros;
+      continue;
+    }
+    flush_zeros();
+
+    uint32_t index = 1;
+    while (order[index] != ch)
+      ++index;
+    std::memmove(order + 1, order, index);
+    order[0] = ch;
+    symbols.push_back(index + 1);
+  }
+  flush_zeros();
+
+  return symbols;
+}
+
+uint64_t plan_bwt_block(const std::vector<Byte> &data, Block &block,
+                        std::vector<uint16_t> &symbols, bool optimal_lengths) {
+  if (data.empty() || data.size() > BWT_MAX_BLOCK_SIZE)
+    return UINT64_MAX;
+
+  symbols = mtf_encode(bwt_forward(data, block.start_rows));
+
+  std::vector<uint32_t> counts(BWT_ALPHABET_SIZE);
+  for (uint16_t symbol : symbols) {
+    counts[symbol]++;
+  }
+  block.code_lengths =
+      limited_code_lengths(counts, MAX_CODE_LENGTH, optimal_lengths);
+
+  // BWT blocks always list their lengths
+  return START_ROWS_SIZE + listed_lengths_size(block.code_lengths) +
+         (canonical_bits(counts, block.code_lengths, SYMBOLS_8) + CHAR_BIT -
+          1) / CHAR_BIT;
+}
+
+std::vector<Byte> bwt_encode(const std::vector<uint16_t> &symbols,
+                             const Block &block) {
+  std::vector<uint32_t> codes;
+  {
+    StageTimer timer(STAGE_TABLE);
+    codes = canonical_codes(block.code_lengths);
+  }
+
+  StageTimer timer(STAGE_ENCODE, block.raw_size);
+
+  BitWriter writer;
+  for (uint16_t symbol : symbols) {
+    writer.put(codes[symbol], block.code_lengths[symbol]);
+  }
+  writer.flush();
+
+  return writer.bytes;
+}
+
+std::vector<Byte> bwt_decode(const Block &block) {
+  std::vector<DecodeEntry> table = build_decode_table(block.code_lengths);
+  uint32_t table_bits = decode_table_bits(table.size());
+
+  std::vector<Byte> bwt(block.raw_size);
+  {
+    StageTimer timer(STAGE_DECODE, block.raw_size);
+
+    Byte order[UCHAR_MAX + 1];
+    for (int i = 0; i <= UCHAR_MAX; ++i) {
+      order[i] = i;
+    }
+
+    // Runs are cut short where a corrupt block would overflow it
+    BitReader reader(block.data);
+    uint32_t filled = 0;
+    uint64_t zeros = 0;
+    uint32_t digit = 1;
+    while (filled < block.raw_size) {
+      uint32_t symbol = decode_symbol(table, table_bits, reader);
+      bool run_digit = symbol == RUNA || symbol == RUNB;
+      if (run_digit) {
+        zeros += uint64_t(digit) << symbol;
+        digit = std::min<uint64_t>(uint64_t(digit) << 1, block.raw_size);
+        // A run ending the block has nothing after it to end it
+        if (filled + zeros < block.raw_size)
+          continue;
+      }
+
+      uint32_t run = std::min<uint64_t>(zeros, block.raw_size - filled);
+      std::memset(bwt.data() + filled, order[0], run);
+      filled += run;
+      zeros = 0;
+      digit = 1;
+      if (run_digit || filled == block.raw_size)
+        break;
+
+      uint32_t index = symbol - 1;
+      Byte ch = order[index];
+      std::memmove(order + 1, order, index);
+      order[0] = ch;
+      bwt[filled++] = ch;
+    }
+  }
+
+  return bwt_inverse(bwt, block.start_rows);
+}
+
+// Filters
+
+#ifdef __SSE2__
+// SSE2 lane arithmetic picked by the element type
+inline __m128i simd_sub(__m128i a, __m128i b, uint8_t) {
+  return _mm_sub_epi8(a, b);
+}
+inline __m128i simd_sub(__m128i a, __m128i b, uint16_t) {
+  return _mm_sub_epi16(a, b);
+}
+inline __m128i simd_sub(__m128i a, __m128i b, uint32_t) {
+  return _mm_sub_epi32(a, b);
+}
+inline __m128i simd_sub(__m128i a, __m128i b, uint64_t) {
+  return _mm_sub_epi64(a, b);
+}
+inline __m128i simd_add(__m128i a, __m128i b, uint8_t) {
+  return _mm_add_epi8(a, b);
+}
+inline __m128i simd_add(__m128i a, __m128i b, uint16_t) {
+  return _mm_add_epi16(a, b);
+}
+inline __m128i simd_add(__m128i a, __m128i b, uint32_t) {
+  return _mm_add_epi32(a, b);
+}
+inline __m128i simd_add(__m128i a, __m128i b, uint64_t) {
+  return _mm_add_epi64(a, b);
+}
+
+// Every lane of the result holds the last element of v
+template <typename T> inline __m128i simd_broadcast_last(__m128i v) {
+  if (sizeof(T) == 8)
+    return _mm_unpackhi_epi64(v, v);
+  __m128i last = _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 3, 3));
+  if (sizeof(T) == 4)
+    return last;
+  last = _mm_shufflehi_epi16(last, _MM_SHUFFLE(3, 3, 3, 3));
+  last = _mm_unpackhi_epi64(last, last);
+  if (sizeof(T) == 2)
+    return last;
+  last = _mm_srli_epi16(last, 8);
+  return _mm_or_si128(last, _mm_slli_epi16(last, 8));
+}
+#endif
+
+template <typename T> inline T load_element(const Byte *p) {
+  T value;
+  std::memcpy(&value, p, sizeof(T));
+  return value;
+}
+
+template <typename T> inline void store_element(Byte *p, T value) {
+  std::memcpy(p, &value, sizeof(T));
+}
+
+template <typename T>
+void delta_encode_elements(const Byte *in, Byte *out, size_t count) {
+  if (!count)
+    return;
+
+  store_element(out, load_element<T>(in));
+  size_t i = 1;
+
+#ifdef __SSE2__
+  // Each vector minus the same bytes shifted back by one element
+  const size_t lanes = sizeof(__m128i) / sizeof(T);
+  for (; i + lanes <= count; i += lanes) {
+    const Byte *p = in + i * sizeof(T);
+    __m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    __m128i previous =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(p - sizeof(T)));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i * sizeof(T)),
+                     simd_sub(current, previous, T()));
+  }
+#endif
+
+  for (; i < count; ++i) {
+    store_element<T>(out + i * sizeof(T),
+                     load_element<T>(in + i * sizeof(T)) -
+                         load_element<T>(in + (i - 1) * sizeof(T)));
+  }
+}
+
+template <typename T> void delta_decode_elements(Byte *data, size_t count) {
+  size_t i = 0;
+
+#ifdef __SSE2__
+  // A prefix sum within the vector in log2(lanes) shifted adds, then the
+  // running total of the previous vector is added to every lane
+  const size_t lanes = sizeof(__m128i) / sizeof(T);
+  __m128i carry = _mm_setzero_si128();
+  for (; i + lanes <= count; i += lanes) {
+    __m128i *p = reinterpret_cast<__m128i *>(data + i * sizeof(T));
+    __m128i v = _mm_loadu_si128(p);
+    if (sizeof(T) <= 1)
+      v = simd_add(v, _mm_slli_si128(v, 1), T());
+    if (sizeof(T) <= 2)
+      v = simd_add(v, _mm_slli_si128(v, 2), T());
+    if (sizeof(T) <= 4)
+      v = simd_add(v, _mm_slli_si128(v, 4), T());
+    v = simd_add(v, _mm_slli_si128(v, 8), T());
+    v = simd_add(v, carry, T());
+    _mm_storeu_si128(p, v);
+    carry = simd_broadcast_last<T>(v);
+  }
+#endif
+
+  for (i = std::max<size_t>(i, 1); i < count; ++i) {
+    store_element<T>(data + i * sizeof(T),
+                     load_element<T>(data + i * sizeof(T)) +
+                         load_element<T>(data + (i - 1) * sizeof(T)));
+  }
+}
+
+#ifdef __SSE2__
+// Splits a stream of vectors into its even and odd bytes, each as long as half
+// the stream
+inline void split_bytes(const __m128i *in, __m128i *even, __m128i *odd,
+                        int length) {
+  const __m128i low_bytes = _mm_set1_epi16(0x00ff);
+  for (int i = 0; i < length / 2; ++i) {
+    even[i] = _mm_packus_epi16(_mm_and_si128(in[2 * i], low_bytes),
+                               _mm_and_si128(in[2 * i + 1], low_bytes));
+    odd[i] = _mm_packus_epi16(_mm_srli_epi16(in[2 * i], 8),
+                              _mm_srli_epi16(in[2 * i + 1], 8));
+  }
+}
+
+// The inverse of split_bytes
+inline void merge_bytes(const __m128i *even, const __m128i *odd, __m128i *out,
+                        int length) {
+  for (int i = 0; i < length; ++i) {
+    out[2 * i] = _mm_unpacklo_epi8(even[i], odd[i]);
+    out[2 * i + 1] = _mm_unpackhi_epi8(even[i], odd[i]);
+  }
+}
+#endif
+
+template <int Stride>
+void shuffle_elements(const Byte *in, Byte *out, size_t count) {
+  size_t i = 0;
+
+#ifdef __SSE2__
+  // 16 records at a time, split log2(Stride) times into even and odd bytes
+  // until every vector holds one byte lane. After m splits stream r holds
+  // the bytes at offsets r modulo 2^m, stream r + 2^m its odd half.
+  for (; i + 16 <= count; i += 16) {
+    __m128i streams[Stride], split[Stride];
+    for (int v = 0; v < Stride; ++v)
+      streams[v] = _mm_loadu_si128(
+          reinterpret_cast<const __m128i *>(in + i * Stride + v * 16));
+
+    for (int m = 1; m < Stride; m *= 2) {
+      int length = Stride / m;
+      for (int r = 0; r < m; ++r)
+        split_bytes(streams + r * length, split + r * length / 2,
+                    split + (r + m) * length / 2, length);
+      std::copy(split, split + Stride, streams);
+    }
+
+    for (int lane = 0; lane < Stride; ++lane)
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(out + lane * count + i),
+                       streams[lane]);
+  }
+#endif
+
+  for (; i < count; ++i) {
+    for (int lane = 0; lane < Stride; ++lane)
+      out[lane * count + i] = in[i * Stride + lane];
+  }
+}
+
+template <int Stride>
+void unshuffle_elements(const Byte *in, Byte *out, size_t count) {
+  size_t i = 0;
+
+#ifdef __SSE2__
+  // The splits of shuffle_elements undone in reverse order
+  for (; i + 16 <= count; i += 16) {
+    __m128i streams[Stride], merged[Stride];
+    for (int lane = 0; lane < Stride; ++lane)
+      streams[lane] = _mm_loadu_si128(
+          reinterpret_cast<const __m128i *>(in + lane * count + i));
+
+    for (int m = Stride / 2; m >= 1; m /= 2) {
+      int length = Stride / m;
+      for (int r = 0; r < m; ++r)
+        merge_bytes(streams + r * length / 2, streams + (r + m) * length / 2,
+                    merged + r * length, length / 2);
+      std::copy(merged, merged + Stride, streams);
+    }
+
+    for (int v = 0; v < Stride; ++v)
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i * Stride + v * 16),
+                       streams[v]);
+  }
+#endif
+
+  for (; i < count; ++i) {
+    for (int lane = 0; lane < Stride; ++lane)
+      out[i * Stride + lane] = in[lane * count + i];
+  }
+}
+
+void shuffle_bytes(const Byte *in, Byte *out, size_t count, Byte stride) {
+  if (stride == 2)
+    shuffle_elements<2>(in, out, count);
+  else if (stride == 4)
+    shuffle_elements<4>(in, out, count);
+  else if (stride == 8)
+    shuffle_elements<8>(in, out, count);
+  else if (stride == 16)
+    shuffle_elements<16>(in, out, count);
+  else {
+    for (size_t i = 0; i < count; ++i) {
+      for (size_t lane = 0; lane < stride; ++lane)
+        out[lane * count + i] = in[i * stride + lane];
+    }
+  }
+}
+
+void unshuffle_bytes(const Byte *in, Byte *out, size_t count, Byte stride) {
+  if (stride == 2)
+    unshuffle_elements<2>(in, out, count);
+  else if (stride == 4)
+    unshuffle_elements<4>(in, out, count);
+  else if (stride == 8)
+    unshuffle_elements<8>(in, out, count);
+  else if (stride == 16)
+    unshuffle_elements<16>(in, out, count);
+  else {
+    for (size_t i = 0; i < count; ++i) {
+      for (size_t lane = 0; lane < stride; ++lane)
+        out[i * stride + lane] = in[lane * count + i];
+    }
+  }
+}
+
+std::vector<Byte> filter_block(const std::vector<Byte> &data, Byte filter,
+                               Byte width) {
+  StageTimer timer(STAGE_TRANSFORM, data.size());
+
+  // Bytes past the last whole element are kept as they are
+  std::vector<Byte> filtered(data);
+  size_t count = data.size() / width;
+  if (filter == FILTER_DELTA) {
+    if (width == 1)
+      ISA_KERNEL(delta_encode_elements<uint8_t>)(data.data(), filtered.data(),
+                                                 count);
+    else if (width == 2)
+      ISA_KERNEL(delta_encode_elements<uint16_t>)(data.data(), filtered.data(),
+                                                  count);
+    else if (width == 4)
+      ISA_KERNEL(delta_encode_elements<uint32_t>)(data.data(), filtered.data(),
+                                                  count);
+    else
+      ISA_KERNEL(delta_encode_elements<uint64_t>)(data.data(), filtered.data(),
+                                                  count);
+  } else if (filter == FILTER_SHUFFLE) {
+    ISA_KERNEL(shuffle_bytes)(data.data(), filtered.data(), count, width);
+  }
+
+  return filtered;
+}
+
+std::vector<Byte> unfilter_block(std::vector<Byte> data, Byte filter,
+                                 Byte width) {
+  StageTimer timer(STAGE_TRANSFORM, data.size());
+
+  size_t count = data.size() / width;
+  if (filter == FILTER_DELTA) {
+    if (width == 1)
+      ISA_KERNEL(delta_decode_elements<uint8_t>)(data.data(), count);
+    else if (width == 2)
+      ISA_KERNEL(delta_decode_elements<uint16_t>)(data.data(), count);
+    else if (width == 4)
+      ISA_KERNEL(delta_decode_elements<uint32_t>)(data.data(), count);
+    else
+      ISA_KERNEL(delta_decode_elements<uint64_t>)(data.data(), count);
+  } else if (filter == FILTER_SHUFFLE) {
+    std::vector<Byte> shuffled(data);
+    ISA_KERNEL(unshuffle_bytes)(shuffled.data(), data.data(), count, width);
+  }
+
+  return data;
+}
+
+double n_log2_n(uint64_t n) {
+  // Covers every count of a single chunk, merged parts are rarer
+  static const std::vector<float> table = [] {
+    std::vector<float> values(N_LOG2_N_TABLE_SIZE);
+    for (uint32_t i = 1; i < N_LOG2_N_TABLE_SIZE; ++i) {
+      values[i] = i * std::log2(i);
+    }
+    return values;
+  }();
+
+  return n < N_LOG2_N_TABLE_SIZE ? table[n] : n * std::log2(n);
+}
+
+double histogram_cost(const uint32_t *counts) {
+  // The entropy of n bytes is n log2 n minus the sum of c log2 c over the
+  // counts, the table holds an entry per symbol that occurs
+  uint64_t total = 0;
+  double bits = 0;
+  uint32_t symbols = 0;
+  for (int byte = 0; byte <= UCHAR_MAX; ++byte) {
+    if (counts[byte]) {
+      total += counts[byte];
+      bits -= n_log2_n(counts[byte]);
+      symbols++;
+    }
+  }
+  bits += n_log2_n(total);
+
+  return bits / CHAR_BIT + BLOCK_HEADER_SIZE + SYMBOL_WIDTH_FIELD +
+         LENGTHS_SIZE_FIELD + CODE_LENGTH_ENTRY_SIZE * symbols;
+}
+
+uint64_t table_coded_size(const std::map<Byte, uint32_t> &frequencies) {
+  uint32_t counts[UCHAR_MAX + 1] = {};
+  for (auto pair : frequencies) {
+    counts[pair.first] = pair.second;
+  }
+
+  return std::ceil(histogram_cost(counts));
+}
+
+std::vector<std::vector<Byte>> filtered_parts(std::vector<Byte> filtered,
+                                              Byte filter, Byte width) {
+  size_t count = filtered.size() / width;
+  if (filter != FILTER_SHUFFLE || !count)
+    return {std::move(filtered)};
+
+  // Every byte lane gets its own block and table when that saves more than
+  // the extra tables cost, the last one also holds the bytes past the last
+  // record
+  std::vector<std::vector<Byte>> lanes;
+  uint64_t lanes_size = 0;
+  for (size_t lane = 0; lane < width; ++lane) {
+    auto begin = filtered.begin() + lane * count;
+    lanes.emplace_back(begin, lane + 1 < width ? begin + count
+                                               : filtered.end());
+    lanes_size += table_coded_size(count_frequencies(lanes.back()));
+  }
+
+  if (lanes_size < table_coded_size(count_frequencies(filtered)))
+    return lanes;
+  return {std::move(filtered)};
+}
+
+// File IO
+
+std::vector<Byte> read_file_block(std::ifstream &file, uint64_t offset,
+                                  uint32_t size) {
+  StageTimer timer(STAGE_READ);
+
+  std::vector<Byte> block(size);
+  file.seekg(offset, std::ios::beg);
+  file.read(reinterpret_cast<char *>(block.data()),
+            static_cast<std::streamsize>(size));
+  block.resize(file.gcount());
+
+  timer.bytes = block.size();
+  return block;
+}
+
+std::vector<Byte> serialize_word_table(const Block &block) {
+  std::vector<Byte> bytes;
+  put_value(bytes, uint32_t(block.vocabulary.size()));
+
+  for (size_t i = 0; i < block.vocabulary.size(); ++i) {
+    const std::string &word = block.vocabulary[i];
+    size_t shared = 0;
+    if (i > 0) {
+      const std::string &previous = block.vocabulary[i - 1];
+      while (shared < previous.length() && previous[shared] == word[shared])
+        ++shared;
+    }
+
+    put_value(bytes, Byte(shared));
+    put_value(bytes, Byte(word.length() - shared));
+    bytes.insert(bytes.end(), word.begin() + shared, word.end());
+  }
+
+  // Packed when that takes fewer bytes, like canonical blocks
+  std::vector<Byte> packed_lengths = pack_code_lengths(block.code_lengths);
+  if (packed_lengths.size() < listed_lengths_size(block.code_lengths)) {
+    put_value(bytes, TABLE_PACKED);
+    bytes.insert(bytes.end(), packed_lengths.begin(), packed_lengths.end());
+  } else {
+    put_value(bytes, TABLE_STORED);
+    put_code_lengths(bytes, block.code_lengths);
+  }
+
+  return bytes;
+}
+
+bool deserialize_word_table(const Byte *&cursor, const Byte *end,
+                            Block &block) {
+  uint32_t vocabulary_size;
+  if (!get_value(cursor, end, vocabulary_size) ||
+      vocabulary_size > WORD_VOCABULARY_LIMIT)
+    return false;
+
+  block.vocabulary.reserve(vocabulary_size);
+  for (uint32_t i = 0; i < vocabulary_size; ++i) {
+    Byte shared, suffix_length;
+    if (!get_value(cursor, end, shared) ||
+        !get_value(cursor, end, suffix_length) ||
+        (i == 0 ? shared : shared > block.vocabulary.back().length()) ||
+        !(shared + suffix_length) || end - cursor < suffix_length)
+      return false;
+
+    std::string word =
+        i == 0 ? std::string() : block.vocabulary.back().substr(0, shared);
+    word.append(cursor, cursor + suffix_length);
+    cursor += suffix_length;
+    block.vocabulary.push_back(std::move(word));
+  }
+
+  Byte form;
+  block.code_lengths.assign(WORD_FIRST_SYMBOL + vocabulary_size, 0);
+  if (!get_value(cursor, end, form) ||
+      (form == TABLE_PACKED
+           ? !unpack_code_lengths(cursor, end, block.code_lengths)
+           : form != TABLE_STORED ||
+                 !get_code_lengths(cursor, end, block.code_lengths)))
+    return false;
+
+  return block.raw_size == 0 || *std::max_element(block.code_lengths.begin(),
+                                                  block.code_lengths.end());
+}
+
+bool deserialize_code_lengths(const Byte *&cursor, const Byte *end,
+                              Block &block) {
+  if (!get_value(cursor, end, block.symbol_width))
+    return false;
+  block.table_mode = block.symbol_width & TABLE_MODE_MASK;
+  block.symbol_width &= ~TABLE_MODE_MASK;
+  if (block.symbol_width > SYMBOLS_RUNS || block.table_mode > TABLE_BUILTIN ||
+      ((block.table_mode == TABLE_REUSED ||
+        block.table_mode == TABLE_DELTA) &&
+       block.symbol_width == SYMBOLS_PAIRS))
+    return false;
+
+  // The id is checked when the block is decoded, see decode_block
+  if (block.table_mode == TABLE_BUILTIN)
+    return block.symbol_width == SYMBOLS_8 &&
+           get_value(cursor, end, block.table_index) &&
+           block.table_index < STATIC_TABLES &&
+           get_value(cursor, end, block.table_id);
+
+  // Referring blocks are checked against the table once it is known
+  if (block.table_mode == TABLE_REUSED || block.table_mode == TABLE_DELTA) {
+    if (!get_value(cursor, end, block.table_index) ||
+        block.table_index >= TABLE_CACHE_SIZE)
+      return false;
+    if (block.table_mode == TABLE_REUSED)
+      return true;
+
+    uint32_t changes_size;
+    if (!get_value(cursor, end, changes_size) ||
+        changes_size > alphabet_size(block.symbol_width, 0))
+      return false;
+    block.length_changes.resize(changes_size);
+    for (auto &change : block.length_changes) {
+      if (!get_value(cursor, end, change.first) ||
+          !get_value(cursor, end, change.second) ||
+          change.first >= alphabet_size(block.symbol_width, 0) ||
+          change.second > MAX_CODE_LENGTH)
+        return false;
+    }
+    return true;
+  }
+
+  if (block.symbol_width == SYMBOLS_PAIRS) {
+    uint16_t pairs_size;
+    if (!get_value(cursor, end, pairs_size) || pairs_size > PAIR_LIMIT)
+      return false;
+
+    block.pairs.resize(pairs_size);
+    for (auto &pair : block.pairs) {
+      if (!get_value(cursor, end, pair.first) ||
+          !get_value(cursor, end, pair.second))
+        return false;
+    }
+  }
+
+  // Packed lengths are the block's own table like listed ones
+  block.code_lengths.assign(
+      alphabet_size(block.symbol_width, block.pairs.size()), 0);
+  bool packed = block.table_mode == TABLE_PACKED;
+  block.table_mode = TABLE_STORED;
+  return (packed ? unpack_code_lengths(cursor, end, block.code_lengths)
+                 : get_code_lengths(cursor, end, block.code_lengths)) &&
+         (block.raw_size == 0 || *std::max_element(block.code_lengths.begin(),
+                                                   block.code_lengths.end()));
+}
+
+uint32_t listed_lengths_size(const std::vector<Byte> &lengths) {
+  return LENGTHS_SIZE_FIELD +
+         CODE_LENGTH_ENTRY_SIZE *
+             (lengths.size() - std::count(lengths.begin(), lengths.end(), 0));
+}
+
+void put_code_lengths(std::vector<Byte> &bytes,
+                      const std::vector<Byte> &lengths) {
+  put_value(bytes, uint32_t(lengths.size() -
+                            std::count(lengths.begin(), lengths.end(), 0)));
+  for (uint32_t symbol = 0; symbol < lengths.size(); ++symbol) {
+    if (lengths[symbol]) {
+      put_value(bytes, uint16_t(symbol));
+      put_value(bytes, lengths[symbol]);
+    }
+  }
+}
+
+bool get_code_lengths(const Byte *&cursor, const Byte *end,
+                      std::vector<Byte> &lengths) {
+  uint32_t lengths_size;
+  if (!get_value(cursor, end, lengths_size) || lengths_size > lengths.size())
+    return false;
+
+  // The decode table relies on the lengths forming a prefix code
+  uint64_t kraft = 0;
+  for (uint32_t i = 0; i < lengths_size; ++i) {
+    uint16_t symbol;
+    Byte length;
+    if (!get_value(cursor, end, symbol) || !get_value(cursor, end, length) ||
+        symbol >= lengths.size() || !length || length > MAX_CODE_LENGTH ||
+        lengths[symbol])
+      return false;
+    lengths[symbol] = length;
+    kraft += uint64_t(1) << (MAX_CODE_LENGTH - length);
+  }
+
+  return kraft <= uint64_t(1) << MAX_CODE_LENGTH;
+}
+
+std::vector<Byte> pack_code_lengths(const std::vector<Byte> &lengths) {
+  // Lengths and runs as (length symbol, run) pairs, runs of zeros take the
+  // longest zeros symbol they fill and repeats go in runs of up to 6
+  std::vector<std::pair<Byte, uint32_t>> symbols;
+  for (uint32_t symbol = 0; symbol < lengths.size();) {
+    Byte length = lengths[symbol];
+    uint32_t run = 1;
+    while (symbol + run < lengths.size() && lengths[symbol + run] == length)
+      ++run;
+    symbol += run;
+
+    if (!length) {
+      for (uint32_t kind = LENGTH_ZEROS_HUGE; run >= LENGTH_RUN_MIN[1];) {
+        uint32_t min = LENGTH_RUN_MIN[kind - LENGTH_REPEAT];
+        uint32_t max = min + (1 << LENGTH_RUN_EXTRA_BITS[kind - LENGTH_REPEAT]) -
+                       1;
+        if (run < min) {
+          --kind;
+          continue;
+        }
+        uint32_t taken = std::min(run, max);
+        symbols.push_back({Byte(kind), taken - min});
+        run -= taken;
+      }
+    } else {
+      symbols.push_back({length, 0});
+      run--;
+      while (run >= LENGTH_RUN_MIN[0]) {
+        uint32_t taken =
+            std::min(run, LENGTH_RUN_MIN[0] + (1 << LENGTH_RUN_EXTRA_BITS[0]) -
+                              1);
+        symbols.push_back({Byte(LENGTH_REPEAT), taken - LENGTH_RUN_MIN[0]});
+        run -= taken;
+      }
+    }
+    for (; run; --run) {
+      symbols.push_back({length, 0});
+    }
+  }
+
+  std::vector<uint32_t> counts(LENGTH_ALPHABET_SIZE);
+  for (auto symbol : symbols) {
+    counts[symbol.first]++;
+  }
+  std::vector<Byte> code_lengths =
+      limited_code_lengths(counts, MAX_LENGTH_CODE_LENGTH, false);
+  std::vector<uint32_t> codes = canonical_codes(code_lengths);
+
+  BitWriter writer;
+  for (Byte length : code_lengths) {
+    writer.put(length, LENGTH_CODE_BITS);
+  }
+  for (auto symbol : symbols) {
+    writer.put(codes[symbol.first], code_lengths[symbol.first]);
+    if (symbol.first >= LENGTH_REPEAT)
+      writer.put(symbol.second,
+                 LENGTH_RUN_EXTRA_BITS[symbol.first - LENGTH_REPEAT]);
+  }
+  writer.flush();
+  return writer.bytes;
+}
+
+bool unpack_code_lengths(const Byte *&cursor, const Byte *end,
+                         std::vector<Byte> &lengths) {
+  BitReader reader(cursor, end);
+  reader.refill();
+  std::vector<Byte> code_lengths(LENGTH_ALPHABET_SIZE);
+  uint64_t kraft = 0;
+  for (Byte &length : code_lengths) {
+    length = reader.buffer >> (64 - LENGTH_CODE_BITS);
+    reader.consume(LENGTH_CODE_BITS);
+    reader.refill();
+    if (length)
+      kraft += uint64_t(1) << (MAX_LENGTH_CODE_LENGTH - length);
+  }
+  if (kraft > uint64_t(1) << MAX_LENGTH_CODE_LENGTH)
+    return false;
+
+  // Every code is at most MAX_LENGTH_CODE_LENGTH bits, so one lookup decodes
+  // a length symbol, slots no code reaches keep length 0
+  std::pair<Byte, Byte> table[1 << MAX_LENGTH_CODE_LENGTH] = {};
+  std::vector<uint32_t> codes = canonical_codes(code_lengths);
+  for (uint32_t symbol = 0; symbol < LENGTH_ALPHABET_SIZE; ++symbol) {
+    uint32_t length = code_lengths[symbol];
+    if (!length)
+      continue;
+    uint32_t first = codes[symbol] << (MAX_LENGTH_CODE_LENGTH - length);
+    std::fill(table + first,
+              table + first + (1 << (MAX_LENGTH_CODE_LENGTH - length)),
+              std::make_pair(Byte(symbol), Byte(length)));
+  }
+
+  uint64_t bits = LENGTH_CODE_BITS * LENGTH_ALPHABET_SIZE;
+  kraft = 0;
+  Byte previous = 0;
+  for (uint32_t symbol = 0; symbol < lengths.size();) {
+    auto entry = table[reader.buffer >> (64 - MAX_LENGTH_CODE_LENGTH)];
+    if (!entry.second)
+      return false;
+    reader.consume(entry.second);
+    bits += entry.second;
+
+    if (entry.first <= MAX_CODE_LENGTH) {
+      lengths[symbol++] = previous = entry.first;
+      kraft += uint64_t(entry.first != 0) << (MAX_CODE_LENGTH - entry.first);
+      reader.refill();
+      continue;
+    }
+
+    // A repeat needs a length before it, zeros leave the lengths as they are
+    uint32_t kind = entry.first - LENGTH_REPEAT;
+    uint32_t extra_bits = LENGTH_RUN_EXTRA_BITS[kind];
+    uint32_t run =
+        LENGTH_RUN_MIN[kind] + uint32_t(reader.buffer >> (64 - extra_bits));
+    reader.consume(extra_bits);
+    reader.refill();
+    bits += extra_bits;
+    if (run > lengths.size() - symbol || (!kind && !symbol))
+      return false;
+    if (kind)
+      previous = 0;
+    std::fill(lengths.begin() + symbol, lengths.begin() + symbol + run,
+              previous);
+    kraft += uint64_t(run * (previous != 0)) << (MAX_CODE_LENGTH - previous);
+    symbol += run;
+  }
+
+  uint64_t size = (bits + CHAR_BIT - 1) / CHAR_BIT;
+  if (size > uint64_t(end - cursor))
+    return false;
+  cursor += size;
+  return kraft <= uint64_t(1) << MAX_CODE_LENGTH;
+}
+
+std::vector<Byte> serialize_block(const Block &block) {
+  std::vector<Byte> word_table;
+  if (block.type == BLOCK_WORDS)
+    word_table = serialize_word_table(block);
+
+  // Canonical blocks pack their own lengths when that takes fewer bytes
+  std::vector<Byte> packed_lengths;
+  uint32_t payload_size = block.data.size() + word_table.size();
+  uint32_t lengths_table_size = listed_lengths_size(block.code_lengths);
+  if (block.type == BLOCK_CANONICAL && block.table_mode == TABLE_STORED) {
+    packed_lengths = pack_code_lengths(block.code_lengths);
+    if (packed_lengths.size() < lengths_table_size)
+      lengths_table_size = packed_lengths.size();
+    else
+      packed_lengths.clear();
+  }
+  if (block.type == BLOCK_CANONICAL && block.table_mode == TABLE_REUSED) {
+    payload_size += SYMBOL_WIDTH_FIELD + TABLE_INDEX_FIELD;
+  } else if (block.type == BLOCK_CANONICAL &&
+             block.table_mode == TABLE_BUILTIN) {
+    payload_size +=
+        SYMBOL_WIDTH_FIELD + TABLE_INDEX_FIELD + STATIC_TABLE_ID_FIELD;
+  } else if (block.type == BLOCK_CANONICAL &&
+             block.table_mode == TABLE_DELTA) {
+    payload_size += SYMBOL_WIDTH_FIELD + TABLE_INDEX_FIELD +
+                    LENGTHS_SIZE_FIELD +
+                    CODE_LENGTH_ENTRY_SIZE * block.length_changes.size();
+  } else if (block.type == BLOCK_CANONICAL) {
+    payload_size += SYMBOL_WIDTH_FIELD + lengths_table_size;
+    if (block.symbol_width == SYMBOLS_PAIRS)
+      payload_size += PAIRS_SIZE_FIELD + 2 * block.pairs.size();
+  } else if (block.type == BLOCK_BWT) {
+    payload_size += START_ROWS_SIZE + lengths_table_size;
+  } else if (block.type == BLOCK_FILTERED) {
+    payload_size += FILTER_HEADER_SIZE;
+  } else if (block.type == BLOCK_RANS) {
+    payload_size += RANS_SYMBOLS_SIZE_FIELD +
+                    RANS_FREQUENCY_ENTRY_SIZE * block.frequencies.size();
+  }
+
+  std::vector<Byte> bytes;
+  bytes.reserve(BLOCK_HEADER_SIZE + payload_size);
+
+  // Write block header
+
+  put_value(bytes, block.type);
+  put_value(bytes, block.raw_size);
+  put_value(bytes, payload_size);
+
+  // Write frequency table
+
+  if (block.type == BLOCK_RANS) {
+    put_value(bytes, uint16_t(block.frequencies.size()));
+    for (auto pair : block.frequencies) {
+      put_value(bytes, pair.first);
+      put_value(bytes, uint16_t(pair.second));
+    }
+  } else if (block.type == BLOCK_WORDS) {
+    bytes.insert(bytes.end(), word_table.begin(), word_table.end());
+  } else if (block.type == BLOCK_CANONICAL &&
+             block.table_mode != TABLE_STORED) {
+    put_value(bytes, Byte(block.symbol_width | block.table_mode));
+    put_value(bytes, block.table_index);
+    if (block.table_mode == TABLE_BUILTIN)
+      put_value(bytes, block.table_id);
+    if (block.table_mode == TABLE_DELTA) {
+      put_value(bytes, uint32_t(block.length_changes.size()));
+      for (auto change : block.length_changes) {
+        put_value(bytes, change.first);
+        put_value(bytes, change.second);
+      }
+    }
+  } else if (block.type == BLOCK_CANONICAL) {
+    put_value(bytes, Byte(block.symbol_width |
+                          (packed_lengths.empty() ? TABLE_STORED
+                                                  : TABLE_PACKED)));
+    if (block.symbol_width == SYMBOLS_PAIRS) {
+      put_value(bytes, uint16_t(block.pairs.size()));
+      for (auto pair : block.pairs) {
+        put_value(bytes, pair.first);
+        put_value(bytes, pair.second);
+      }
+    }
+
+    if (packed_lengths.empty())
+      put_code_lengths(bytes, block.code_lengths);
+    else
+      bytes.insert(bytes.end(), packed_lengths.begin(), packed_lengths.end());
+  } else if (block.type == BLOCK_BWT) {
+    for (uint32_t row : block.start_rows) {
+      put_value(bytes, row);
+    }
+    put_code_lengths(bytes, block.code_lengths);
+  } else if (block.type == BLOCK_FILTERED) {
+    put_value(bytes, block.filter);
+    put_value(bytes, block.filter_width);
+  }
+
+  // Write block data
+
+  bytes.insert(bytes.end(), block.data.begin(), block.data.end());
+  return bytes;
+}
+
+bool deserialize_block(const std::vector<Byte> &bytes, Block &block) {
+  const Byte *cursor = bytes.data();
+  const Byte *end = cursor + bytes.size();
+
+  uint32_t payload_size;
+  if (!get_value(cursor, end, block.type) ||
+      !get_value(cursor, end, block.raw_size) ||
+      !get_value(cursor, end, payload_size) ||
+      payload_size != uint64_t(end - cursor))
+    return false;
+
+  if (block.type == BLOCK_RANS) {
+    // The decoder's slot table needs the frequencies to cover RANS_SCALE
+    // exactly
+    uint16_t symbols_size;
+    if (!get_value(cursor, end, symbols_size) ||
+        symbols_size > UCHAR_MAX + 1)
+      return false;
+
+    uint32_t total = 0;
+    for (uint32_t i = 0; i < symbols_size; ++i) {
+      Byte ch;
+      uint16_t frequency;
+      if (!get_value(cursor, end, ch) || !get_value(cursor, end, frequency) ||
+          !frequency || block.frequencies.count(ch))
+        return false;
+      block.frequencies[ch] = frequency;
+      total += frequency;
+    }
+    if (total != RANS_SCALE)
+      return false;
+  } else if (block.type == BLOCK_WORDS) {
+    if (!deserialize_word_table(cursor, end, block))
+      return false;
+  } else if (block.type == BLOCK_CANONICAL) {
+    if (!deserialize_code_lengths(cursor, end, block))
+      return false;
+  } else if (block.type == BLOCK_BWT) {
+    if (!block.raw_size || block.raw_size > BWT_MAX_BLOCK_SIZE)
+      return false;
+    for (uint32_t &row : block.start_rows) {
+      if (!get_value(cursor, end, row) || row > block.raw_size)
+        return false;
+    }
+
+    // Row 0 is the terminator, it never holds the whole block
+    block.code_lengths.assign(BWT_ALPHABET_SIZE, 0);
+    if (!block.start_rows[0] ||
+        !get_code_lengths(cursor, end, block.code_lengths))
+      return false;
+  } else if (block.type == BLOCK_SPLIT) {
+    // The parts are checked as they are decoded
+  } else if (block.type == BLOCK_FILTERED) {
+    if (!get_value(cursor, end, block.filter) ||
+        !get_value(cursor, end, block.filter_width) ||
+        (block.filter == FILTER_DELTA
+             ? block.filter_width != 1 && block.filter_width != 2 &&
+                   block.filter_width != 4 && block.filter_width != 8
+             : block.filter != FILTER_SHUFFLE || block.filter_width < 2))
+      return false;
+  } else if (block.type != BLOCK_STORED ||
+             payload_size != block.raw_size) {
+    return false;
+  }
+
+  block.data.assign(cursor, end);
+  return true;
+}
+
+uint32_t static_table_id(const std::vector<Byte> &lengths) {
+  // 32 bit FNV-1a
+  uint32_t id = 2166136261u;
+  for (Byte length : lengths) {
+    id = (id ^ length) * 16777619u;
+  }
+  return id;
+}
+
+void generate_static_tables(const std::vector<const char *> &files) {
+  // The training files, one per table, then the header to write
+  std::ofstream file(files[STATIC_TABLES], std::ios::binary);
+  if (!file)
+    exit_with_error(std::string("Could not open ") + files[STATIC_TABLES]);
+
+  std::ostringstream header;
+
+  header << "// Generated by ./huffman --generate-tables from";
+  for (uint32_t index = 0; index < STATIC_TABLES; ++index) {
+    header << " " << files[index];
+  }
+  header << ", do not edit\n";
+
+  std::vector<std::vector<Byte>> lengths(STATIC_TABLES);
+  std::vector<std::vector<uint32_t>> codes(STATIC_TABLES);
+  std::vector<std::vector<DecodeEntry>> decode_tables(STATIC_TABLES);
+  for (uint32_t index = 0; index < STATIC_TABLES; ++index) {
+    std::ifstream file(files[index], std::ios::binary);
+    if (!file)
+      exit_with_error(std::string("Could not open ") + files[index]);
+
+    uint64_t totals[UCHAR_MAX + 1] = {};
+    std::vector<Byte> buffer(1 << 20);
+    while (file.read(reinterpret_cast<char *>(buffer.data()), buffer.size()) ||
+           file.gcount()) {
+      uint32_t counts[UCHAR_MAX + 1];
+      count_bytes(buffer.data(), file.gcount(), counts);
+      for (int byte = 0; byte <= UCHAR_MAX; ++byte) {
+        totals[byte] += counts[byte];
+      }
+    }
+
+    // Scaled into 32 bits, every byte gets a count and with that a code
+    uint64_t largest = *std::max_element(totals, totals + UCHAR_MAX + 1);
+    uint32_t shift = 0;
+    while (largest >> shift >= 1u << 24)
+      ++shift;
+    std::vector<uint32_t> counts(UCHAR_MAX + 1);
+    for (int byte = 0; byte <= UCHAR_MAX; ++byte) {
+      counts[byte] = uint32_t(totals[byte] >> shift) + 1;
+    }
+
+    lengths[index] =
+        limited_code_lengths(counts, STATIC_MAX_CODE_LENGTH, false);
+    codes[index] = canonical_codes(lengths[index]);
+    decode_tables[index] = build_decode_table(lengths[index]);
+  }
+
+  header << "\nconstexpr Byte "
+            "STATIC_CODE_LENGTHS[STATIC_TABLES][UCHAR_MAX + 1] = {\n";
+  for (uint32_t index = 0; index < STATIC_TABLES; ++index) {
+    header << "    {";
+    for (int byte = 0; byte <= UCHAR_MAX; ++byte) {
+      header << (byte % 16 ? " " : "\n        ") << int(lengths[index][byte])
+             << ",";
+    }
+    header << "\n    },\n";
+  }
+  header << "};\n";
+
+  header << "\nconstexpr uint32_t STATIC_CODES[STATIC_TABLES][UCHAR_MAX + 1] = "
+            "{\n";
+  for (uint32_t index = 0; index < STATIC_TABLES; ++index) {
+    header << "    {";
+    for (int byte = 0; byte <= UCHAR_MAX; ++byte) {
+      header << (byte % 8 ? " " : "\n        ") << codes[index][byte] << ",";
+    }
+    header << "\n    },\n";
+  }
+  header << "};\n";
+
+  for (uint32_t index = 0; index < STATIC_TABLES; ++index) {
+    header << "\nconstexpr DecodeEntry STATIC_DECODE_TABLE_" << index
+           << "[] = {";
+    for (size_t entry = 0; entry < decode_tables[index].size(); ++entry) {
+      const DecodeEntry &decode = decode_tables[index][entry];
+      header << (entry % 4 ? " " : "\n    ") << "{" << decode.value << ", "
+             << int(decode.length) << ", " << int(decode.subtable_bits)
+             << "},";
+    }
+    header << "\n};\n";
+  }
+
+  header << "\nconstexpr BuiltinTable BUILTIN_TABLES[STATIC_TABLES] = {\n";
+  for (uint32_t index = 0; index < STATIC_TABLES; ++index) {
+    header << "    {STATIC_CODE_LENGTHS[" << index << "], STATIC_CODES["
+           << index << "], STATIC_DECODE_TABLE_" << index << ",\n     "
+           << decode_tables[index].size() << ", "
+           << static_table_id(lengths[index]) << "u},\n";
+  }
+  header << "};\n";
+
+  // The sources use CRLF line endings, and so does the header
+  for (char c : header.str()) {
+    if (c == '\n')
+      file << '\r';
+    file << c;
+  }
+  file.flush();
+  if (!file)
+    exit_with_error(std::string("Could not write ") + files[STATIC_TABLES]);
+  std::cout << "Wrote the built-in tables to " << files[STATIC_TABLES]
+            << ", rebuild to use them" << std::endl;
+}
+
+#ifdef __linux__
+
+bool io_ring_setup(IoRing &ring, unsigned entries) {
+  io_uring_params params = {};
+  ring.fd = syscall(__NR_io_uring_setup, entries, &params);
+  if (ring.fd < 0)
+    return false;
+
+  ring.sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  ring.cq_ring_size =
+      params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+  // Newer kernels map both rings with a single mmap
+  bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+  if (single_mmap) {
+    ring.sq_ring_size = ring.cq_ring_size =
+        std::max(ring.sq_ring_size, ring.cq_ring_size);
+  }
+
+  ring.sq_ring = mmap(nullptr, ring.sq_ring_size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, ring.fd, IORING_OFF_SQ_RING);
+  ring.cq_ring = single_mmap ? ring.sq_ring
+                             : mmap(nullptr, ring.cq_ring_size,
+                                    PROT_READ | PROT_WRITE,
+                                    MAP_SHARED | MAP_POPULATE, ring.fd,
+                                    IORING_OFF_CQ_RING);
+  ring.sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+  ring.sqes = static_cast<io_uring_sqe *>(
+      mmap(nullptr, ring.sqes_size, PROT_READ | PROT_WRITE,
+           MAP_SHARED | MAP_POPULATE, ring.fd, IORING_OFF_SQES));
+
+  if (ring.sq_ring == MAP_FAILED || ring.cq_ring == MAP_FAILED ||
+      ring.sqes == MAP_FAILED) {
+    io_ring_destroy(ring);
+    return false;
+  }
+
+  Byte *sq = static_cast<Byte *>(ring.sq_ring);
+  Byte *cq = static_cast<Byte *>(ring.cq_ring);
+  ring.sq_head = reinterpret_cast<unsigned *>(sq + params.sq_off.head);
+  ring.sq_tail = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+  ring.sq_mask = reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+  ring.sq_array = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+  ring.cq_head = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+  ring.cq_tail = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+  ring.cq_mask = reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+  ring.cqes = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+  ring.sq_entries = params.sq_entries;
+
+  return true;
+}
+
+void io_ring_destroy(IoRing &ring) {
+  if (ring.sqes && ring.sqes != MAP_FAILED)
+    munmap(ring.sqes, ring.sqes_size);
+  if (ring.cq_ring && ring.cq_ring != MAP_FAILED && ring.cq_ring != ring.sq_ring)
+    munmap(ring.cq_ring, ring.cq_ring_size);
+  if (ring.sq_ring && ring.sq_ring != MAP_FAILED)
+    munmap(ring.sq_ring, ring.sq_ring_size);
+  if (ring.fd >= 0)
+    close(ring.fd);
+  ring = IoRing();
+}
+
+bool io_ring_register_buffers(IoRing &ring,
+                              std::vector<std::vector<Byte>> &buffers) {
+  std::vector<iovec> iovecs;
+  for (auto &buffer : buffers) {
+    iovecs.push_back({buffer.data(), buffer.capacity()});
+  }
+
+  return syscall(__NR_io_uring_register, ring.fd, IORING_REGISTER_BUFFERS,
+                 iovecs.data(), iovecs.size()) == 0;
+}
+
+bool io_ring_queue(IoRing &ring, Byte opcode, int fd, void *buffer,
+                   uint32_t length, uint64_t offset, uint64_t user_data,
+                   int buffer_index) {
+  unsigned tail = *ring.sq_tail;
+  if (tail - __atomic_load_n(ring.sq_head, __ATOMIC_ACQUIRE) >=
+      ring.sq_entries)
+    return false;
+
+  unsigned index = tail & *ring.sq_mask;
+  io_uring_sqe &sqe = ring.sqes[index];
+  std::memset(&sqe, 0, sizeof(sqe));
+  sqe.opcode = opcode;
+  sqe.fd = fd;
+  sqe.addr = reinterpret_cast<uint64_t>(buffer);
+  sqe.len = length;
+  sqe.off = offset;
+  sqe.user_data = user_data;
+  if (buffer_index >= 0)
+    sqe.buf_index = buffer_index;
+
+  ring.sq_array[index] = index;
+  __atomic_store_n(ring.sq_tail, tail + 1, __ATOMIC_RELEASE);
+  ring.unsubmitted++;
+  return true;
+}
+
+bool io_ring_submit(IoRing &ring, unsigned wait_count) {
+  while (true) {
+    int submitted =
+        syscall(__NR_io_uring_enter, ring.fd, ring.unsubmitted, wait_count,
+                wait_count ? IORING_ENTER_GETEVENTS : 0, nullptr, 0);
+    if (submitted >= 0) {
+      ring.unsubmitted -= submitted;
+      return true;
+    }
+    if (errno != EINTR)
+      return false;
+  }
+}
+
+bool io_ring_reap(IoRing &ring, uint64_t &user_data, int32_t &result) {
+  unsigned head = *ring.cq_head;
+  if (head == __atomic_load_n(ring.cq_tail, __ATOMIC_ACQUIRE))
+    return false;
+
+  const io_uring_cqe &cqe = ring.cqes[head & *ring.cq_mask];
+  user_data = cqe.user_data;
+  result = cqe.res;
+  __atomic_store_n(ring.cq_head, head + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+#else
+
+bool io_ring_setup(IoRing &ring, unsigned entries) { return false; }
+void io_ring_destroy(IoRing &ring) {}
+bool io_ring_register_buffers(IoRing &ring,
+                              std::vector<std::vector<Byte>> &buffers) {
+  return false;
+}
+bool io_ring_queue(IoRing &ring, Byte opcode, int fd, void *buffer,
+                   uint32_t length, uint64_t offset, uint64_t user_data,
+                   int buffer_index) {
+  return false;
+}
+bool io_ring_submit(IoRing &ring, unsigned wait_count) { return false; }
+bool io_ring_reap(IoRing &ring, uint64_t &user_data, int32_t &result) {
+  return false;
+}
+
+#endif
+
+void read_fully(int fd, Byte *buffer, uint32_t length, uint64_t offset) {
+  while (length) {
+    ssize_t count = pread(fd, buffer, length, offset);
+    if (count < 0 && errno == EINTR)
+      continue;
+    if (count <= 0)
+      exit_with_error(std::string("Could not read input: ") +
+                      (count ? std::strerror(errno) : "unexpected end of file"));
+    buffer += count;
+    length -= count;
+    offset += count;
+  }
+}
+
+void write_fully(int fd, const Byte *buffer, size_t length, uint64_t offset) {
+  while (length) {
+    ssize_t count = pwrite(fd, buffer, length, offset);
+    if (count < 0 && errno == EINTR)
+      continue;
+    if (count <= 0)
+      exit_with_error(std::string("Could not write output: ") +
+                      std::strerror(errno));
+    buffer += count;
+    length -= count;
+    offset += count;
+  }
+}
+
+void preallocate_file(int fd, uint64_t size) {
+#ifdef __linux__
+  if (fallocate(fd, 0, 0, size) == 0)
+    return;
+#endif
+  // Not every file system can allocate ahead, the file is still sized up
+  // front so blocks can be written at any offset
+  if (ftruncate(fd, size) < 0)
+    exit_with_error(std::string("Could not size output: ") +
+                    std::strerror(errno));
+}
+
+void pipeline_read_blocks(BlockPipeline &pipeline) {
+  uint32_t next = 0;
+
+  if (!pipeline.use_io_uring) {
+    // Reads one block at a time, still overlapping with the workers
+    for (; next < pipeline.extents.size(); ++next) {
+      int buffer;
+      {
+        std::unique_lock<std::mutex> lock(pipeline.mutex);
+        pipeline.changed.wait(lock,
+                              [&] { return !pipeline.free_buffers.empty(); });
+        buffer = pipeline.free_buffers.back();
+        pipeline.free_buffers.pop_back();
+      }
+
+      const Extent &extent = pipeline.extents[next];
+      auto &data = pipeline.buffers[buffer];
+      data.resize(extent.length);
+      {
+        StageTimer timer(STAGE_READ, extent.length);
+        read_fully(pipeline.in_fd, data.data(), extent.length, extent.offset);
+      }
+
+      std::lock_guard<std::mutex> lock(pipeline.mutex);
+      pipeline.jobs.push_back({next, buffer});
+      pipeline.changed.notify_all();
+    }
+    return;
+  }
+
+  // Keeps a read in flight for every free buffer, the buffers are registered
+  // with the ring so the kernel does not map them on every read
+  std::vector<uint32_t> read_sizes(pipeline.buffers.size());
+  uint32_t in_flight = 0;
+
+  while (next < pipeline.extents.size() || in_flight) {
+    {
+      std::unique_lock<std::mutex> lock(pipeline.mutex);
+      if (!in_flight) {
+        pipeline.changed.wait(lock,
+                              [&] { return !pipeline.free_buffers.empty(); });
+      }
+
+      while (next < pipeline.extents.size() &&
+             !pipeline.free_buffers.empty()) {
+        int buffer = pipeline.free_buffers.back();
+        pipeline.free_buffers.pop_back();
+
+        const Extent &extent = pipeline.extents[next];
+        auto &data = pipeline.buffers[buffer];
+        data.resize(extent.length);
+        read_sizes[buffer] = 0;
+
+        io_ring_queue(pipeline.read_ring, IORING_OP_READ_FIXED, pipeline.in_fd,
+                      data.data(), extent.length, extent.offset,
+                      uint64_t(next) << 32 | buffer, buffer);
+        next++;
+        in_flight++;
+      }
+    }
+
+    StageTimer timer(STAGE_READ);
+    if (!io_ring_submit(pipeline.read_ring, 1))
+      exit_with_error(std::string("Could not read input: ") +
+                      std::strerror(errno));
+
+    uint64_t user_data;
+    int32_t result;
+    while (io_ring_reap(pipeline.read_ring, user_data, result)) {
+      uint32_t index = user_data >> 32;
+      int buffer = user_data & 0xFFFFFFFF;
+      const Extent &extent = pipeline.extents[index];
+
+      if (result <= 0)
+        exit_with_error(std::string("Could not read input: ") +
+                        (result ? std::strerror(-result)
+                                : "unexpected end of file"));
+
+      timer.bytes += result;
+      read_sizes[buffer] += result;
+
+      // Short reads are resubmitted for the rest of the block
+      if (read_sizes[buffer] < extent.length) {
+        io_ring_queue(pipeline.read_ring, IORING_OP_READ_FIXED, pipeline.in_fd,
+                      pipeline.buffers[buffer].data() + read_sizes[buffer],
+                      extent.length - read_sizes[buffer],
+                      extent.offset + read_sizes[buffer], user_data, buffer);
+        continue;
+      }
 
-  uint32_t data_size;
-  input_file.read(reinterpret_cast<char *>(&data_size), sizeof(data_size));
+      in_flight--;
+      std::lock_guard<std::mutex> lock(pipeline.mutex);
+      pipeline.jobs.push_back({index, buffer});
+      pipeline.changed.notify_all();
+    }
+  }
+}
+
+void pipeline_transform_blocks(BlockPipeline &pipeline) {
+  while (true) {
+    PipelineJob job;
+    {
+      std::unique_lock<std::mutex> lock(pipeline.mutex);
+      pipeline.changed.wait(lock, [&] {
+        return !pipeline.jobs.empty() || pipeline.reading_done;
+      });
+      if (pipeline.jobs.empty())
+        return;
+
+      job = pipeline.jobs.front();
+      pipeline.jobs.pop_front();
+    }
+
+    job.output = pipeline.transform(pipeline.buffers[job.buffer]);
+
+    std::vector<PipelineJob> placed;
+    if (!pipeline.out_offsets.empty()) {
+      job.out_offset = pipeline.out_offsets[job.index];
+      placed.push_back(std::move(job));
+    } else {
+      // A block is placed once the sizes of all blocks before it are known,
+      // whichever worker finishes the missing block places the ones after it
+      std::lock_guard<std::mutex> lock(pipeline.mutex);
+      pipeline.unplaced[job.index] = std::move(job);
+
+      auto next = pipeline.unplaced.find(pipeline.next_unplaced);
+      while (next != pipeline.unplaced.end()) {
+        next->second.out_offset = pipeline.out_offset;
+        pipeline.out_offset += next->second.output.size();
+        placed.push_back(std::move(next->second));
+        pipeline.unplaced.erase(next);
+        next = pipeline.unplaced.find(++pipeline.next_unplaced);
+      }
+    }
+
+    for (const auto &ready : placed) {
+      {
+        StageTimer timer(STAGE_WRITE, ready.output.size());
+        write_fully(pipeline.out_fd, ready.output.data(), ready.output.size(),
+                    ready.out_offset);
+      }
+
+      std::lock_guard<std::mutex> lock(pipeline.mutex);
+      pipeline.free_buffers.push_back(ready.buffer);
+      pipeline.changed.notify_all();
+    }
+  }
+}
 
-  uint32_t padding;
-  input_file.read(reinterpret_cast<char *>(&padding), sizeof(padding));
+uint64_t run_block_pipeline(int in_fd, const std::vector<Extent> &extents,
+                            int out_fd, const std::vector<uint64_t> &out_offsets,
+                            uint64_t out_offset,
+                            const BlockTransform &transform,
+                            const PipelinePlan &plan, const Options &options) {
+  if (extents.empty())
+    return 0;
 
-  uint32_t frequencies_size;
-  input_file.read(reinterpret_cast<char *>(&frequencies_size),
-                  sizeof(frequencies_size));
+  BlockPipeline pipeline{in_fd,       extents,    out_fd,
+                         out_offsets, out_offset, transform};
 
-  for (int i = 0; i < frequencies_size; ++i) {
-    Byte ch;
-    uint32_t frequency;
-    input_file.read(reinterpret_cast<char *>(&ch), sizeof(ch));
-    input_file.read(reinterpret_cast<char *>(&frequency), sizeof(frequency));
-    frequencies[ch] = frequency;
+  unsigned workers = plan.workers;
+  STATS.threads = workers;
+
+  size_t depth = std::min(plan.depth, extents.size());
+  uint32_t max_length = 0;
+  for (const auto &extent : extents) {
+    max_length = std::max(max_length, extent.length);
+  }
+
+  pipeline.buffers.resize(depth);
+  for (size_t i = 0; i < depth; ++i) {
+    pipeline.buffers[i].reserve(max_length);
+    pipeline.free_buffers.push_back(i);
+  }
+
+  if (options.io != IO_PREAD) {
+    pipeline.use_io_uring =
+        io_ring_setup(pipeline.read_ring, depth) &&
+        io_ring_register_buffers(pipeline.read_ring, pipeline.buffers);
+
+    if (!pipeline.use_io_uring && options.io == IO_URING)
+      exit_with_error(std::string("io_uring is not available: ") +
+                      std::strerror(errno));
+  }
+
+  std::vector<std::thread> threads;
+  for (unsigned i = 0; i < workers; ++i) {
+    threads.emplace_back(pipeline_transform_blocks, std::ref(pipeline));
+  }
+  pipeline_read_blocks(pipeline);
+  {
+    std::lock_guard<std::mutex> lock(pipeline.mutex);
+    pipeline.reading_done = true;
+    pipeline.changed.notify_all();
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
   }
 
-  data = std::vector<Byte>(data_size);
-  input_file.read(reinterpret_cast<char *>(reinterpret_cast<char *>(&data[0])),
-                  static_cast<int>(sizeof(Byte) * data_size));
-  input_file.close();
+  io_ring_destroy(pipeline.read_ring);
 
-  return padding;
+  return pipeline.out_offset - out_offset;
 }
 
-void write_uncompressed_file(const std::vector<Byte> &data,
-                             const char *filename) {
-  std::ofstream output_file(filename, std::ios::trunc | std::ios::binary);
-  output_file.write(reinterpret_cast<const char *>(&data[0]),
-                    static_cast<int>(sizeof(Byte) * data.size()));
-  output_file.close();
+bool plan_pipeline(uint64_t memory_limit, uint64_t block_memory,
+                   uint64_t worker_memory, PipelinePlan &plan) {
+  // Enough blocks in flight to keep every worker busy while others wait on
+  // the reader or for their offset. Over the limit, workers go down first,
+  // each with at least its own block, then the blocks in flight are topped up
+  // again. The output does not depend on either
+  auto fits = [&] {
+    return !memory_limit ||
+           pipeline_memory(block_memory, worker_memory, plan) <= memory_limit;
+  };
+
+  for (plan.depth = plan.workers; !fits(); plan.depth = plan.workers) {
+    if (plan.workers == 1)
+      return false;
+    --plan.workers;
+  }
+  while (plan.depth < 2 * plan.workers + 2) {
+    ++plan.depth;
+    if (!fits()) {
+      --plan.depth;
+      break;
+    }
+  }
+
+  return true;
+}
+
+uint64_t pipeline_memory(uint64_t block_memory, uint64_t worker_memory,
+                         const PipelinePlan &plan) {
+  return MEMORY_BASE + plan.depth * block_memory + plan.workers * worker_memory;
 }
 
-void write_compressed_file(uint32_t original_file_size,
-                           std::string &compressed_data, uint32_t padding,
-                           const std::map<Byte, uint32_t> &frequencies,
-                           const char *filename) {
+// Compression
 
-  std::ofstream output_file(filename, std::ios::trunc | std::ios::binary);
+std::vector<uint32_t>
+split_block(const std::vector<Byte> &data,
+            std::vector<std::vector<uint32_t>> &histograms) {
+  StageTimer timer(STAGE_HISTOGRAM);
 
-  // Pad data
+  // Every chunk starts as its own part, then the neighbours whose merged
+  // histogram costs the least over coding them apart are merged for as long
+  // as that saves bytes. The histograms of the parts are left in histograms
+  std::vector<uint32_t> ends;
+  histograms.clear();
+  std::vector<double> costs;
+  for (uint32_t start = 0; start < data.size(); start += SPLIT_CHUNK_SIZE) {
+    ends.push_back(
+        std::min<uint64_t>(start + SPLIT_CHUNK_SIZE, data.size()));
+    histograms.emplace_back(UCHAR_MAX + 1);
+    count_bytes(data.data() + start, ends.back() - start,
+                histograms.back().data());
+    costs.push_back(histogram_cost(histograms.back().data()));
+  }
 
-  compressed_data += std::string(padding, PADDING_BIT);
+  // savings[i] is what merging part i and i + 1 saves
+  std::vector<uint32_t> merged(UCHAR_MAX + 1);
+  auto merge_cost = [&](size_t i) {
+    for (int byte = 0; byte <= UCHAR_MAX; ++byte) {
+      merged[byte] = histograms[i][byte] + histograms[i + 1][byte];
+    }
+    return histogram_cost(merged.data());
+  };
+  std::vector<double> savings;
+  for (size_t i = 0; i + 1 < ends.size(); ++i) {
+    savings.push_back(costs[i] + costs[i + 1] - merge_cost(i));
+  }
 
-  // Write Header
+  while (!savings.empty()) {
+    size_t best = std::max_element(savings.begin(), savings.end()) -
+                  savings.begin();
+    if (savings[best] < 0)
+      break;
 
-  auto data_size = compressed_data.length() / CHAR_BIT;
-  auto frequencies_size = frequencies.size();
+    costs[best] = merge_cost(best);
+    for (int byte = 0; byte <= UCHAR_MAX; ++byte) {
+      histograms[best][byte] += histograms[best + 1][byte];
+    }
+    ends[best] = ends[best + 1];
+    ends.erase(ends.begin() + best + 1);
+    histograms.erase(histograms.begin() + best + 1);
+    costs.erase(costs.begin() + best + 1);
+    savings.erase(savings.begin() + best);
 
-  output_file.write(reinterpret_cast<const char *>(&original_file_size),
-                    sizeof(original_file_size));
-  output_file.write(reinterpret_cast<const char *>(&data_size),
-                    sizeof(data_size));
-  output_file.write(reinterpret_cast<const char *>(&padding), sizeof(padding));
-  output_file.write(reinterpret_cast<const char *>(&frequencies_size),
-                    sizeof(frequencies_size));
+    if (best > 0)
+      savings[best - 1] = costs[best - 1] + costs[best] - merge_cost(best - 1);
+    if (best < savings.size())
+      savings[best] = costs[best] + costs[best + 1] - merge_cost(best);
+  }
 
-  // Write frequency table
+  return ends;
+}
 
-  for (auto pair : frequencies) {
-    output_file.write(reinterpret_cast<const char *>(&pair.first),
-                      sizeof(pair.first));
-    output_file.write(reinterpret_cast<const char *>(&pair.second),
-                      sizeof(pair.second));
+std::vector<Byte> compress_split_block(const std::vector<Byte> &data,
+                                       const CompressionLevel &level) {
+  // A block is histogrammed in several passes, only the time of each is
+  // added, its bytes are counted once here
+  STATS.stages[STAGE_HISTOGRAM].bytes += data.size();
+
+  if (!level.split || data.size() <= SPLIT_CHUNK_SIZE)
+    return serialize_block(compress_block(data, level, nullptr));
+
+  std::vector<std::vector<uint32_t>> histograms;
+  std::vector<uint32_t> ends = split_block(data, histograms);
+  if (ends.size() == 1)
+    return serialize_block(compress_block(data, level, nullptr));
+
+  // The parts follow each other in a split block, where they can refer to
+  // each other's tables
+  Block block;
+  block.type = BLOCK_SPLIT;
+  block.raw_size = data.size();
+
+  TableCache tables;
+  uint32_t start = 0;
+  for (uint32_t end : ends) {
+    std::vector<Byte> part(data.begin() + start, data.begin() + end);
+    std::vector<Byte> bytes =
+        serialize_block(compress_block(part, level, &tables));
+    block.data.insert(block.data.end(), bytes.begin(), bytes.end());
+    start = end;
   }
 
-  // Write compressed data
+  return serialize_block(block);
+}
+
+Block compress_block(const std::vector<Byte> &data,
+                     const CompressionLevel &level, TableCache *tables) {
+  STATS.blocks++;
+
+  Block block;
+  if (level.filter != FILTER_NONE && !data.empty() &&
+      encode_filtered_block(data, level, block))
+    return block;
+
+  return encode_block(data, level, tables);
+}
+
+bool encode_filtered_block(const std::vector<Byte> &data,
+                           const CompressionLevel &level, Block &block) {
+  std::vector<Byte> filtered =
+      filter_block(data, level.filter, level.filter_width);
+  if (level.filter == FILTER_DELTA &&
+      shannon_entropy(count_frequencies(filtered)) >=
+          shannon_entropy(count_frequencies(data)))
+    return false;
+
+  CompressionLevel inner_level = level;
+  inner_level.filter = FILTER_NONE;
 
-  for (int i = 0; i < compressed_data.length(); i += CHAR_BIT) {
-    auto byte = static_cast<char>(
-        std::bitset<CHAR_BIT>(compressed_data, i, CHAR_BIT).to_ulong() &
-        0xFFul);
-    output_file.write(reinterpret_cast<const char *>(&byte), sizeof(byte));
+  block.type = BLOCK_FILTERED;
+  block.raw_size = data.size();
+  block.filter = level.filter;
+  block.filter_width = level.filter_width;
+
+  // Stored data is better off unfiltered
+  bool stored = true;
+  TableCache tables;
+  for (const std::vector<Byte> &part : filtered_parts(
+           std::move(filtered), level.filter, level.filter_width)) {
+    Block inner = encode_block(part, inner_level, &tables);
+    stored = stored && inner.type == BLOCK_STORED;
+    std::vector<Byte> bytes = serialize_block(inner);
+    block.data.insert(block.data.end(), bytes.begin(), bytes.end());
   }
 
-  output_file.close();
+  return !stored;
 }
 
-// Compression
+Block encode_block(const std::vector<Byte> &data,
+                   const CompressionLevel &level, TableCache *tables) {
+  Block block;
+  block.type = BLOCK_CANONICAL;
+  block.raw_size = data.size();
+
+  // Small blocks at fast levels take the best built-in table as it is,
+  // unless their entropy says a table of their own clearly pays
+  if (data.size() <= level.static_size) {
+    uint32_t counts[UCHAR_MAX + 1] = {};
+    count_bytes(data.data(), data.size(), counts);
+    uint64_t builtin_size = plan_builtin_block(counts, block);
+    if (BLOCK_HEADER_SIZE + builtin_size <= histogram_cost(counts)) {
+      if (builtin_size >= block.raw_size) {
+        block.type = BLOCK_STORED;
+        block.code_lengths.clear();
+        block.data = data;
+      } else {
+        block.data = canonical_encode(data, block);
+      }
+      return block;
+    }
+  }
 
-uint32_t compress(const std::vector<Byte> &data, const char *filename) {
+  if (sample_looks_incompressible(data, level.sample_size)) {
+    block.type = BLOCK_STORED;
+    block.data = data;
+    return block;
+  }
 
-  uint32_t original_file_size = data.size();
-  auto frequencies = count_frequencies(data);
-  HuffmanNode *root = build_huffman_tree(frequencies);
-  std::map<Byte, std::string> substitution_table;
-  create_substitution_table(root, substitution_table);
+  block.frequencies = count_frequencies(data, level.histogram_threads);
 
-  uint32_t encodedSize = 0;
-  for (const auto &pair : substitution_table) {
-    encodedSize += frequencies[pair.first] * pair.second.length();
+  uint64_t data_size = UINT64_MAX;
+  if (level.coder != CODER_RANS) {
+    data_size =
+        plan_canonical_block(data, block.frequencies, level, block);
   }
 
-  uint32_t padding = CHAR_BIT - (encodedSize % CHAR_BIT);
-  std::string encoded;
-  encoded.reserve(encodedSize + padding);
-  for (Byte ch : data) {
-    encoded += substitution_table[ch];
+  WordModel words;
+  if (level.coder == CODER_WORDS) {
+    words = build_word_model(data, level.optimal_lengths);
+    uint64_t words_size = word_data_size(words);
+    if (words_size < data_size) {
+      block.type = BLOCK_WORDS;
+      data_size = words_size;
+    }
+  }
+
+  // A stream that can win is encoded right away, which takes no longer than
+  // working out its exact size, and kept if it does
+  std::map<Byte, uint32_t> normalized;
+  std::vector<Byte> rans_stream;
+  if (level.coder == CODER_RANS || level.coder == CODER_AUTO ||
+      level.coder == CODER_BWT) {
+    normalized = normalize_frequencies(block.frequencies, block.raw_size);
+    if (rans_can_win(block.frequencies, normalized, data_size)) {
+      rans_stream = rans_encode(data, normalized);
+      uint64_t rans_size = RANS_SYMBOLS_SIZE_FIELD +
+                           RANS_FREQUENCY_ENTRY_SIZE * normalized.size() +
+                           rans_stream.size();
+      if (rans_size < data_size) {
+        block.type = BLOCK_RANS;
+        data_size = rans_size;
+      }
+    }
+  }
+
+  Block bwt_block;
+  std::vector<uint16_t> bwt_symbols;
+  if (level.coder == CODER_BWT) {
+    uint64_t bwt_size =
+        plan_bwt_block(data, bwt_block, bwt_symbols, level.optimal_lengths);
+    if (bwt_size < data_size) {
+      block.type = BLOCK_BWT;
+      data_size = bwt_size;
+    }
+  }
+
+  // Incompressible data is stored as is, so a block never grows by more than
+  // its header
+  if (data_size >= block.raw_size) {
+    block.type = BLOCK_STORED;
+    block.frequencies.clear();
+    block.data = data;
+    return block;
+  }
+
+  if (block.type == BLOCK_RANS) {
+    block.frequencies = normalized;
+    block.data = std::move(rans_stream);
+    return block;
+  }
+
+  if (block.type == BLOCK_BWT) {
+    block.frequencies.clear();
+    std::copy(bwt_block.start_rows, bwt_block.start_rows + BWT_STREAMS,
+              block.start_rows);
+    block.code_lengths = std::move(bwt_block.code_lengths);
+    block.data = bwt_encode(bwt_symbols, block);
+    return block;
+  }
+
+  if (block.type == BLOCK_WORDS) {
+    block.frequencies.clear();
+    block.data = encode_words(words);
+    block.vocabulary = std::move(words.vocabulary);
+    block.code_lengths = std::move(words.code_lengths);
+    return block;
   }
 
-  write_compressed_file(original_file_size, encoded, padding, frequencies,
-                        filename);
+  block.frequencies.clear();
+  if (tables)
+    choose_table(data, block, *tables, level.reuse_tables, data_size);
+  block.data = canonical_encode(data, block);
+  return block;
+}
+
+uint64_t compress_memory(const CompressionLevel &level, uint32_t block_size,
+                         uint64_t &worker_memory) {
+  uint32_t factor = COMPRESS_MEMORY_FACTORS[level.coder];
+  if (level.filter != FILTER_NONE)
+    factor += FILTER_MEMORY_FACTOR;
+  worker_memory = uint64_t(factor) * block_size;
+
+  // The block and its output, which is never larger than the block plus a
+  // header per part
+  return 2 * uint64_t(block_size) +
+         uint64_t(BLOCK_HEADER_SIZE) * (block_size / SPLIT_CHUNK_SIZE + 1);
+}
+
+PipelinePlan plan_compression(const CompressionLevel &level,
+                              uint32_t file_size, const Options &options) {
+  // Smaller blocks code worse, so they are only used when a single worker
+  // does not fit with the level's
+  PipelinePlan plan;
+  plan.block_size = level.block_size;
+  while (true) {
+    uint32_t blocks = (uint64_t(file_size) + plan.block_size - 1) /
+                      plan.block_size;
+    plan.workers = std::max(1u, std::min(options.threads, blocks));
+
+    uint64_t worker_memory;
+    uint64_t block_memory = compress_memory(
+        level, std::min(plan.block_size, file_size), worker_memory);
+    if (plan_pipeline(options.memory_limit, block_memory, worker_memory,
+                      plan))
+      return plan;
+
+    if (plan.block_size / 2 < MIN_MEMORY_BLOCK_SIZE) {
+      exit_with_error(
+          "--memory-limit=" + std::to_string(options.memory_limit) +
+          " is too low, compressing with this level takes at least " +
+          std::to_string(pipeline_memory(block_memory, worker_memory, plan)) +
+          " bytes");
+    }
+    plan.block_size /= 2;
+  }
+}
 
-  return encoded.length() / CHAR_BIT;
+void put_file_header(std::vector<Byte> &bytes, uint32_t original_size) {
+  bytes.insert(bytes.end(), std::begin(FILE_MAGIC), std::end(FILE_MAGIC));
+  put_value(bytes, FORMAT_VERSION);
+  put_value(bytes, original_size);
 }
 
-void compress_to_file(const char *from_file, const char *_to_file) {
-  auto data = read_uncompressed_file(from_file);
+void compress_buffer(const Byte *data, uint64_t size,
+                     const CompressionLevel &level, std::vector<Byte> &output) {
+  // Same format as a compressed file, without the pipeline
+  if (size > UINT32_MAX)
+    exit_with_error("Input is larger than 4 GiB");
+
+  output.clear();
+  put_file_header(output, size);
+  std::vector<Byte> block;
+  for (uint64_t offset = 0; offset < size; offset += level.block_size) {
+    block.assign(data + offset,
+                 data + std::min<uint64_t>(offset + level.block_size, size));
+    std::vector<Byte> compressed = compress_split_block(block, level);
+    output.insert(output.end(), compressed.begin(), compressed.end());
+  }
+}
 
+void compress_to_file(const char *from_file, const char *_to_file,
+                      const Options &options) {
   std::string to_file(_to_file);
 
   auto end =
@@ -410,34 +5245,817 @@ void compress_to_file(const char *from_file, const char *_to_file) {
   if (end != COMPRESSED_FILE_EXTENSION)
     to_file += COMPRESSED_FILE_EXTENSION;
 
-  uint32_t compressed_size = compress(data, to_file.c_str());
-  file_compressed_message(data.size(), compressed_size, from_file);
+  int in_fd = open(from_file, O_RDONLY);
+  struct stat in_stat;
+  if (in_fd < 0 || fstat(in_fd, &in_stat) < 0)
+    exit_with_error(std::string("Could not open ") + from_file + ": " +
+                    std::strerror(errno));
+
+  // The header stores the size in 32 bits
+  if (uint64_t(in_stat.st_size) > UINT32_MAX)
+    exit_with_error(std::string(from_file) + " is larger than 4 GiB");
+  uint32_t original_file_size = in_stat.st_size;
+
+  CompressionLevel level = effective_level(options);
+  PipelinePlan plan = plan_compression(level, original_file_size, options);
+  level.block_size = plan.block_size;
+  level.histogram_threads = std::max(1u, options.threads / plan.workers);
+  std::vector<Extent> extents;
+  for (uint64_t offset = 0; offset < original_file_size;
+       offset += level.block_size) {
+    extents.push_back(
+        {offset, static_cast<uint32_t>(std::min<uint64_t>(
+                     level.block_size, original_file_size - offset))});
+  }
+
+  int out_fd = open(to_file.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (out_fd < 0)
+    exit_with_error("Could not create " + to_file + ": " +
+                    std::strerror(errno));
+
+  // A block is never larger than its header plus the raw data, and split
+  // blocks hold at most one part per chunk, so the output is allocated for
+  // that and cut to size once every block is written
+  uint64_t max_blocks = extents.size();
+  if (level.split)
+    max_blocks +=
+        (original_file_size + SPLIT_CHUNK_SIZE - 1) / SPLIT_CHUNK_SIZE;
+  preallocate_file(out_fd, FILE_HEADER_SIZE +
+                               uint64_t(BLOCK_HEADER_SIZE) * max_blocks +
+                               original_file_size);
+
+  // Write Header
+
+  std::vector<Byte> header;
+  put_file_header(header, original_file_size);
+  write_fully(out_fd, header.data(), header.size(), 0);
+
+  uint64_t compressed_size =
+      FILE_HEADER_SIZE +
+      run_block_pipeline(
+          in_fd, extents, out_fd, {}, FILE_HEADER_SIZE,
+          [&](const std::vector<Byte> &data) {
+            return compress_split_block(data, level);
+          },
+          plan, options);
+
+  if (ftruncate(out_fd, compressed_size) < 0)
+    exit_with_error("Could not size " + to_file + ": " + std::strerror(errno));
+
+  close(in_fd);
+  close(out_fd);
+
+  STATS.bytes_in = original_file_size;
+  STATS.bytes_out = compressed_size;
+  file_compressed_message(original_file_size, compressed_size, from_file);
+}
+
+// Estimation
+
+SizeEstimate estimate_block(const std::vector<Byte> &data,
+                            const std::map<Byte, uint32_t> &frequencies,
+                            const CompressionLevel &level, TableCache *tables) {
+  uint32_t raw_size = data.size();
+  SizeEstimate estimate;
+  estimate.original_size = raw_size;
+  estimate.blocks = 1;
+  estimate.sampled_blocks = 1;
+
+  if (!raw_size)
+    return estimate;
+
+  // Mirrors encode_filtered_block
+  if (level.filter != FILTER_NONE) {
+    std::vector<Byte> filtered =
+        filter_block(data, level.filter, level.filter_width);
+
+    if (level.filter == FILTER_SHUFFLE ||
+        shannon_entropy(count_frequencies(filtered)) <
+            shannon_entropy(frequencies)) {
+      CompressionLevel inner_level = level;
+      inner_level.filter = FILTER_NONE;
+
+      bool stored = true;
+      uint64_t parts_size = 0;
+      TableCache filtered_tables;
+      for (const std::vector<Byte> &part : filtered_parts(
+               std::move(filtered), level.filter, level.filter_width)) {
+        SizeEstimate inner = estimate_block(part, count_frequencies(part),
+                                            inner_level, &filtered_tables);
+        stored = stored && inner.type == BLOCK_STORED;
+        parts_size += inner.compressed_size;
+      }
+
+      if (!stored) {
+        estimate.type = BLOCK_FILTERED;
+        estimate.compressed_size =
+            BLOCK_HEADER_SIZE + FILTER_HEADER_SIZE + parts_size;
+        estimate.entropy = shannon_entropy(frequencies);
+        return estimate;
+      }
+    }
+  }
+
+  // Mirrors the fast path of encode_block
+  if (raw_size <= level.static_size) {
+    uint32_t counts[UCHAR_MAX + 1] = {};
+    for (const auto &entry : frequencies)
+      counts[entry.first] = entry.second;
+    Block block;
+    uint64_t data_size = plan_builtin_block(counts, block);
+    if (BLOCK_HEADER_SIZE + data_size <= histogram_cost(counts)) {
+      estimate.type = data_size < raw_size ? BLOCK_CANONICAL : BLOCK_STORED;
+      estimate.compressed_size =
+          BLOCK_HEADER_SIZE + std::min<uint64_t>(data_size, raw_size);
+      estimate.entropy = shannon_entropy(frequencies);
+      return estimate;
+    }
+  }
+
+  if (sample_looks_incompressible(data, level.sample_size)) {
+    estimate.type = BLOCK_STORED;
+    estimate.compressed_size = BLOCK_HEADER_SIZE + raw_size;
+    estimate.entropy = shannon_entropy(frequencies);
+    return estimate;
+  }
+
+  // Mirrors the choice encode_block makes, only words, wide symbols and
+  // shared tables need more than the histogram
+  uint64_t data_size = UINT64_MAX;
+  Block canonical_block;
+  if (level.coder != CODER_RANS) {
+    data_size = plan_canonical_block(data, frequencies, level,
+                                     canonical_block);
+    estimate.type = BLOCK_CANONICAL;
+  }
+
+  if (level.coder == CODER_WORDS) {
+    uint64_t words_size =
+        word_data_size(build_word_model(data, level.optimal_lengths));
+    if (words_size < data_size) {
+      estimate.type = BLOCK_WORDS;
+      data_size = words_size;
+    }
+  }
+
+  if (level.coder == CODER_RANS || level.coder == CODER_AUTO ||
+      level.coder == CODER_BWT) {
+    std::map<Byte, uint32_t> normalized =
+        normalize_frequencies(frequencies, raw_size);
+    if (rans_can_win(frequencies, normalized, data_size)) {
+      uint64_t rans_size = rans_data_size(data, normalized);
+      if (rans_size < data_size) {
+        estimate.type = BLOCK_RANS;
+        data_size = rans_size;
+      }
+    }
+  }
+
+  if (level.coder == CODER_BWT) {
+    Block block;
+    std::vector<uint16_t> symbols;
+    uint64_t bwt_size =
+        plan_bwt_block(data, block, symbols, level.optimal_lengths);
+    if (bwt_size < data_size) {
+      estimate.type = BLOCK_BWT;
+      data_size = bwt_size;
+    }
+  }
+
+  if (data_size >= raw_size) {
+    estimate.type = BLOCK_STORED;
+    data_size = raw_size;
+  }
+
+  if (estimate.type == BLOCK_CANONICAL && tables)
+    choose_table(data, canonical_block, *tables, level.reuse_tables,
+                 data_size);
+
+  estimate.compressed_size = BLOCK_HEADER_SIZE + data_size;
+  estimate.entropy = shannon_entropy(frequencies);
+  return estimate;
+}
+
+SizeEstimate estimate_split_block(const std::vector<Byte> &data,
+                                  const uint64_t *counts,
+                                  const CompressionLevel &level) {
+  std::map<Byte, uint32_t> frequencies = histogram_frequencies(counts);
+
+  // The histograms of the parts come from splitting, a whole block has the
+  // counts it was given
+  std::vector<uint32_t> ends = {uint32_t(data.size())};
+  std::vector<std::vector<uint32_t>> histograms;
+  if (level.split && data.size() > SPLIT_CHUNK_SIZE)
+    ends = split_block(data, histograms);
+
+  // Parts are estimated like the blocks compress_split_block writes, inside a
+  // split block once there are several
+  SizeEstimate estimate;
+  TableCache tables;
+  uint32_t start = 0;
+  for (size_t i = 0; i < ends.size(); ++i) {
+    uint32_t end = ends[i];
+    std::vector<Byte> part(data.begin() + start, data.begin() + end);
+    SizeEstimate part_estimate = estimate_block(
+        part,
+        ends.size() > 1 ? histogram_frequencies(histograms[i].data())
+                        : frequencies,
+        level, ends.size() > 1 ? &tables : nullptr);
+
+    // The type is only reported when every part has the same
+    if (start == 0) {
+      estimate = part_estimate;
+    } else {
+      estimate.compressed_size += part_estimate.compressed_size;
+      if (part_estimate.type != estimate.type)
+        estimate.type = BLOCK_CANONICAL;
+    }
+    start = end;
+  }
+
+  if (ends.size() > 1)
+    estimate.compressed_size += BLOCK_HEADER_SIZE;
+  estimate.original_size = data.size();
+  estimate.entropy = shannon_entropy(frequencies);
+  return estimate;
+}
+
+SizeEstimate estimate_file(const char *filename, bool sample,
+                           const CompressionLevel &level, unsigned threads,
+                           std::vector<SizeEstimate> &block_estimates) {
+  std::ifstream input_file(filename, std::ios::binary);
+  if (!input_file)
+    exit_with_error(std::string("Could not open ") + filename + ": " +
+                    std::strerror(errno));
+
+  SizeEstimate estimate;
+  estimate.original_size = get_file_size(input_file);
+  estimate.blocks =
+      (estimate.original_size + level.block_size - 1) / level.block_size;
+  STATS.bytes_in = estimate.original_size;
+
+  uint32_t stride = 1;
+  if (sample || estimate.original_size > ESTIMATE_EXACT_LIMIT)
+    stride = std::max<uint32_t>(1, estimate.blocks / ESTIMATE_SAMPLE_BLOCKS);
+
+  std::vector<uint32_t> sampled_blocks;
+  for (uint32_t i = 0; i < estimate.blocks; i += stride)
+    sampled_blocks.push_back(i);
+  block_estimates.assign(sampled_blocks.size(), SizeEstimate());
+
+  // Workers claim blocks in turn, threads left over once every block has one
+  // count the histograms of the blocks
+  unsigned workers = std::max<size_t>(
+      1, std::min<size_t>(threads, sampled_blocks.size()));
+  CompressionLevel block_level = level;
+  block_level.histogram_threads = std::max(1u, threads / workers);
+  STATS.threads = workers;
+
+  // The file entropy comes from the histograms of the blocks, each worker
+  // sums its share in its own cache lines, which are added up once all are done
+  struct alignas(CACHE_LINE_SIZE) WorkerCounts {
+    uint64_t counts[UCHAR_MAX + 1] = {};
+  };
+  std::vector<WorkerCounts> worker_counts(workers);
+  std::atomic<size_t> next_block{0};
+  auto estimate_blocks = [&](WorkerCounts &local) {
+    std::ifstream file(filename, std::ios::binary);
+    for (size_t k; (k = next_block++) < sampled_blocks.size();) {
+      auto data =
+          read_file_block(file, uint64_t(sampled_blocks[k]) * level.block_size,
+                          level.block_size);
+      uint64_t block_counts[UCHAR_MAX + 1];
+      {
+        StageTimer timer(STAGE_HISTOGRAM, data.size());
+        count_bytes_parallel(data.data(), data.size(), block_counts,
+                             block_level.histogram_threads);
+        for (int byte = 0; byte <= UCHAR_MAX; ++byte)
+          local.counts[byte] += block_counts[byte];
+      }
+
+      block_estimates[k] = estimate_split_block(data, block_counts, block_level);
+      block_estimates[k].block = sampled_blocks[k];
+      STATS.blocks++;
+    }
+  };
+
+  std::vector<std::thread> helpers;
+  for (unsigned i = 1; i < workers; ++i)
+    helpers.emplace_back([&, i] { estimate_blocks(worker_counts[i]); });
+  estimate_blocks(worker_counts[0]);
+  for (auto &helper : helpers)
+    helper.join();
+
+  uint64_t file_counts[UCHAR_MAX + 1] = {};
+  for (const WorkerCounts &local : worker_counts) {
+    for (int byte = 0; byte <= UCHAR_MAX; ++byte)
+      file_counts[byte] += local.counts[byte];
+  }
+  std::map<Byte, uint32_t> file_frequencies = histogram_frequencies(file_counts);
+
+  uint64_t sampled_size = 0;
+  uint64_t sampled_compressed_size = 0;
+  for (const auto &block_estimate : block_estimates) {
+    sampled_size += block_estimate.original_size;
+    sampled_compressed_size += block_estimate.compressed_size;
+  }
+  estimate.sampled_blocks = block_estimates.size();
+
+  // Scale the sampled blocks up to the whole file
+  estimate.compressed_size = FILE_HEADER_SIZE + sampled_compressed_size;
+  if (sampled_size < estimate.original_size) {
+    estimate.compressed_size =
+        FILE_HEADER_SIZE + static_cast<uint64_t>(double(sampled_compressed_size) /
+                                                 sampled_size *
+                                                 estimate.original_size);
+  }
+  estimate.entropy = shannon_entropy(file_frequencies);
+  STATS.bytes_out = estimate.compressed_size;
+
+  return estimate;
 }
 
 // Decompression
 
-std::vector<Byte> decompress(std::string &bits, uint32_t padding,
-                             const std::map<Byte, uint32_t> &frequencies) {
-  HuffmanNode *root = build_huffman_tree(frequencies);
+std::vector<Byte> decompress_block(const Block &block) {
+  // The parts of a split block are counted instead
+  if (block.type == BLOCK_SPLIT)
+    return decode_inner_blocks(block);
+
+  STATS.blocks++;
+
+  if (block.type == BLOCK_FILTERED)
+    return unfilter_block(decode_inner_blocks(block), block.filter,
+                          block.filter_width);
+  return decode_block(block, nullptr);
+}
 
-  bits.erase(bits.length() - padding);
-  int index = -1;
+std::vector<Byte> decode_inner_blocks(const Block &block) {
+  // The inner blocks follow each other, each header gives the next offset.
+  // Split blocks may hold filtered ones, filtered blocks nothing but plain
+  // ones
+  const char *corrupt = block.type == BLOCK_SPLIT ? "Corrupt split block"
+                                                  : "Corrupt filtered block";
   std::vector<Byte> decoded;
-  while (index < static_cast<int>(bits.size()) - 2) {
-    decode(root, index, bits, decoded);
+  decoded.reserve(block.raw_size);
+  TableCache tables;
+
+  const Byte *cursor = block.data.data();
+  const Byte *end = cursor + block.data.size();
+  while (cursor < end) {
+    const Byte *size_field = cursor + sizeof(Byte) + sizeof(uint32_t);
+    uint32_t payload_size;
+    Block inner;
+    if (!get_value(size_field, end, payload_size) ||
+        payload_size > uint64_t(end - size_field) ||
+        !deserialize_block(std::vector<Byte>(cursor,
+                                             size_field + payload_size),
+                           inner) ||
+        inner.type == BLOCK_SPLIT ||
+        (inner.type == BLOCK_FILTERED && block.type == BLOCK_FILTERED) ||
+        inner.raw_size > block.raw_size - decoded.size())
+      exit_with_error(corrupt);
+
+    std::vector<Byte> part;
+    if (block.type == BLOCK_SPLIT)
+      STATS.blocks++;
+    if (inner.type == BLOCK_FILTERED)
+      part = unfilter_block(decode_inner_blocks(inner), inner.filter,
+                            inner.filter_width);
+    else
+      part = decode_block(inner, &tables);
+    decoded.insert(decoded.end(), part.begin(), part.end());
+    cursor = size_field + payload_size;
   }
 
+  if (decoded.size() != block.raw_size)
+    exit_with_error(corrupt);
   return decoded;
 }
 
-void decompress_to_file(const char *from_file, const char *to_file) {
-  std::vector<Byte> data;
-  std::map<Byte, uint32_t> frequencies;
+std::vector<Byte> decode_block(const Block &block, TableCache *tables) {
+  if (block.type == BLOCK_STORED) {
+    StageTimer timer(STAGE_DECODE, block.raw_size);
+    return block.data;
+  }
+
+  if (block.type == BLOCK_RANS)
+    return ISA_KERNEL(rans_decode)(block.data, block.raw_size,
+                                   block.frequencies);
+  if (block.type == BLOCK_CANONICAL && block.table_mode == TABLE_BUILTIN) {
+    const BuiltinTable &table = BUILTIN_TABLES[block.table_index];
+    if (block.table_id != table.id)
+      exit_with_error("A block was coded with a built-in table this build "
+                      "does not have");
+    return canonical_decode(block, table.decode_table, table.decode_table_size);
+  }
+  // Pair tables are never cached, see choose_table
+  if (block.type == BLOCK_CANONICAL && tables &&
+      block.symbol_width != SYMBOLS_PAIRS) {
+    resolve_table(block, *tables);
+    const std::vector<DecodeEntry> &table = tables->front().decode_table;
+    return canonical_decode(block, table.data(), table.size());
+  }
+  if (block.type == BLOCK_CANONICAL) {
+    if (block.table_mode != TABLE_STORED)
+      exit_with_error("Corrupt block, it refers to a missing table");
+    std::vector<DecodeEntry> table = build_decode_table(block.code_lengths);
+    return canonical_decode(block, table.data(), table.size());
+  }
+  if (block.type == BLOCK_WORDS)
+    return decode_words(block);
+
+  // deserialize_block lets no other type through
+  return ISA_KERNEL(bwt_decode)(block);
+}
+
+void get_file_header(const Byte *&cursor, const Byte *end,
+                     const std::string &name, uint32_t &original_size) {
+  if (size_t(end - cursor) < FILE_HEADER_SIZE ||
+      !std::equal(std::begin(FILE_MAGIC), std::end(FILE_MAGIC), cursor))
+    exit_with_error(name + " is not a huffman file, or was written by a "
+                           "version from before format versions");
+  cursor += sizeof(FILE_MAGIC);
+
+  Byte version = 0;
+  get_value(cursor, end, version);
+  if (version != FORMAT_VERSION)
+    exit_with_error(name + " has format version " + std::to_string(version) +
+                    ", this huffman only reads version " +
+                    std::to_string(FORMAT_VERSION));
+  get_value(cursor, end, original_size);
+}
+
+uint64_t decode_memory(Byte type, uint32_t raw_size, uint32_t payload_size) {
+  // The parts of split and filtered blocks can be any other type, and are
+  // put together in a second buffer
+  uint64_t memory = payload_size + uint64_t(raw_size);
+  if (type == BLOCK_BWT || type == BLOCK_SPLIT || type == BLOCK_FILTERED)
+    memory += uint64_t(BWT_DECODE_MEMORY_FACTOR) * raw_size;
+
+  return memory;
+}
+
+void decompress_buffer(const Byte *data, uint64_t size,
+                       std::vector<Byte> &output) {
+  const char *corrupt = "Corrupt input";
+  const Byte *cursor = data;
+  const Byte *end = data + size;
+  uint32_t original_size;
+  get_file_header(cursor, end, "Input", original_size);
+
+  output.clear();
+  std::vector<Byte> bytes;
+  while (output.size() < original_size) {
+    if (end - cursor < ptrdiff_t(BLOCK_HEADER_SIZE))
+      exit_with_error(corrupt);
+
+    const Byte *size_field = cursor + sizeof(Byte) + sizeof(uint32_t);
+    uint32_t payload_size;
+    if (!get_value(size_field, end, payload_size) ||
+        payload_size > uint64_t(end - size_field))
+      exit_with_error(corrupt);
+
+    Block block;
+    bytes.assign(cursor, size_field + payload_size);
+    if (!deserialize_block(bytes, block) ||
+        block.raw_size > original_size - output.size())
+      exit_with_error(corrupt);
+
+    std::vector<Byte> part = decompress_block(block);
+    if (part.size() != block.raw_size)
+      exit_with_error(corrupt);
+    output.insert(output.end(), part.begin(), part.end());
+    cursor = size_field + payload_size;
+  }
+}
+
+void decompress_to_file(const char *from_file, const char *to_file,
+                        const Options &options) {
+  int in_fd = open(from_file, O_RDONLY);
+  if (in_fd < 0)
+    exit_with_error(std::string("Could not open ") + from_file + ": " +
+                    std::strerror(errno));
+
+  // Read header, then walk the block headers to find where every block is
+  // and where it goes in the output. Blocks must fit in the file and add up
+  // to the original size
+  std::string corrupt = std::string(from_file) + " is corrupt";
+  struct stat in_stat;
+  if (fstat(in_fd, &in_stat) < 0)
+    exit_with_error(std::string("Could not read ") + from_file + ": " +
+                    std::strerror(errno));
+  uint64_t file_size = in_stat.st_size;
+
+  std::vector<Extent> extents;
+  std::vector<uint64_t> out_offsets;
+  uint32_t original_file_size;
+  uint64_t offset = FILE_HEADER_SIZE;
+  uint64_t block_memory = 0, worker_memory = 0;
+  {
+    StageTimer timer(STAGE_READ);
+
+    Byte header[std::max(FILE_HEADER_SIZE, BLOCK_HEADER_SIZE)];
+    const Byte *cursor = header;
+    uint32_t header_size = std::min<uint64_t>(file_size, FILE_HEADER_SIZE);
+    read_fully(in_fd, header, header_size, 0);
+    get_file_header(cursor, header + header_size, from_file,
+                    original_file_size);
+
+    uint64_t raw_size = 0;
+    while (raw_size < original_file_size) {
+      if (file_size - offset < BLOCK_HEADER_SIZE)
+        exit_with_error(corrupt);
+      read_fully(in_fd, header, BLOCK_HEADER_SIZE, offset);
+
+      Byte type;
+      uint32_t block_raw_size, payload_size;
+      cursor = header;
+      get_value(cursor, header + BLOCK_HEADER_SIZE, type);
+      get_value(cursor, header + BLOCK_HEADER_SIZE, block_raw_size);
+      get_value(cursor, header + BLOCK_HEADER_SIZE, payload_size);
+      if (block_raw_size > original_file_size - raw_size ||
+          payload_size > file_size - offset - BLOCK_HEADER_SIZE)
+        exit_with_error(corrupt);
+
+      extents.push_back({offset, BLOCK_HEADER_SIZE + payload_size});
+      out_offsets.push_back(raw_size);
+      block_memory = std::max(block_memory, uint64_t(BLOCK_HEADER_SIZE) +
+                                                payload_size + block_raw_size);
+      worker_memory = std::max(
+          worker_memory, decode_memory(type, block_raw_size, payload_size));
+      offset += BLOCK_HEADER_SIZE + payload_size;
+      raw_size += block_raw_size;
+    }
+  }
+
+  // Block sizes are fixed by the file, so only workers and blocks in flight
+  // can go down
+  PipelinePlan plan;
+  plan.block_size = 0;
+  plan.workers = std::max<unsigned>(
+      1, std::min<size_t>(options.threads, extents.size()));
+  if (!plan_pipeline(options.memory_limit, block_memory, worker_memory,
+                     plan)) {
+    exit_with_error(
+        "--memory-limit=" + std::to_string(options.memory_limit) +
+        " is too low, decompressing " + from_file + " takes at least " +
+        std::to_string(pipeline_memory(block_memory, worker_memory, plan)) +
+        " bytes");
+  }
+
+  int out_fd = open(to_file, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (out_fd < 0)
+    exit_with_error(std::string("Could not create ") + to_file + ": " +
+                    std::strerror(errno));
+
+  // The output is sized exactly upfront and every block lands at its offset
+  // as soon as it is decoded
+  preallocate_file(out_fd, original_file_size);
+
+  run_block_pipeline(
+      in_fd, extents, out_fd, out_offsets, 0,
+      [&](const std::vector<Byte> &bytes) {
+        Block block;
+        if (!deserialize_block(bytes, block))
+          exit_with_error(corrupt);
+        std::vector<Byte> part = decompress_block(block);
+        if (part.size() != block.raw_size)
+          exit_with_error(corrupt);
+        return part;
+      },
+      plan, options);
+
+  close(in_fd);
+  close(out_fd);
+
+  STATS.bytes_in = offset;
+  STATS.bytes_out = original_file_size;
+}
+
+// Server
+
+void serve(const char *socket_path, const Options &options) {
+  sockaddr_un address = {};
+  address.sun_family = AF_UNIX;
+  if (std::strlen(socket_path) >= sizeof(address.sun_path))
+    exit_with_error(std::string("Socket path is too long: ") + socket_path);
+  std::strcpy(address.sun_path, socket_path);
+
+  // A socket left behind by an earlier server is replaced, other files are
+  // not
+  struct stat path_stat;
+  if (lstat(socket_path, &path_stat) == 0 && S_ISSOCK(path_stat.st_mode))
+    unlink(socket_path);
+
+  int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (listen_fd < 0 ||
+      bind(listen_fd, reinterpret_cast<sockaddr *>(&address),
+           sizeof(address)) < 0 ||
+      listen(listen_fd, SOMAXCONN) < 0)
+    exit_with_error(std::string("Could not listen on ") + socket_path + ": " +
+                    std::strerror(errno));
+
+  // From here on errors only fail their request, and clients that go away
+  // only end their connection
+  SERVING = true;
+  signal(SIGPIPE, SIG_IGN);
+
+  // The built-in tables are compiled in, this builds the only table that is
+  // built on first use so no request pays for it
+  n_log2_n(1);
+
+  std::vector<std::thread> threads;
+  for (unsigned i = 0; i < std::max(1u, options.threads); ++i) {
+    threads.emplace_back(serve_connections, listen_fd, std::cref(options));
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+}
+
+void serve_connections(int listen_fd, const Options &options) {
+  // Every worker serves one connection at a time and keeps its buffers
+  // across requests
+  std::vector<Byte> input, output;
+  while (true) {
+    int fd = accept(listen_fd, nullptr, nullptr);
+    if (fd < 0)
+      continue;
+
+    while (serve_request(fd, options, input, output)) {
+    }
+    close(fd);
+  }
+}
+
+bool serve_request(int fd, const Options &options, std::vector<Byte> &input,
+                   std::vector<Byte> &output) {
+  Byte header[SERVE_REQUEST_HEADER_SIZE];
+  std::vector<int> fds;
+  bool received = receive_fully(fd, header, sizeof(header), fds);
+
+  const Byte *cursor = header;
+  const Byte *end = header + sizeof(header);
+  Byte operation = 0, level = 0;
+  uint64_t size = 0;
+  received = received && get_value(cursor, end, operation) &&
+             get_value(cursor, end, level) && get_value(cursor, end, size);
 
-  uint32_t padding = read_compressed_file(from_file, data, frequencies);
+  // Inline input is read before anything can fail, so the connection stays
+  // in step. Inputs over the limit, or that there is no memory for, are
+  // refused and end the connection instead of being read
+  uint64_t max_size = SERVE_MAX_INLINE_SIZE;
+  if (options.memory_limit)
+    max_size = std::min(max_size, options.memory_limit);
+  std::string refusal;
+  if (received && size > max_size) {
+    refusal = "Inline input is larger than " + std::to_string(max_size) +
+              " bytes, pass a file descriptor instead";
+  } else if (received) {
+    try {
+      input.resize(size);
+    } catch (const std::bad_alloc &) {
+      refusal = "Out of memory for " + std::to_string(size) + " bytes of input";
+    }
+  }
+  if (!refusal.empty()) {
+    send_response(fd, SERVE_FAILED, refusal.size(),
+                  std::vector<Byte>(refusal.begin(), refusal.end()));
+    received = false;
+  }
+  if (received)
+    received = receive_fully(fd, input.data(), size, fds);
+  if (!received) {
+    for (int passed : fds) {
+      close(passed);
+    }
+    return false;
+  }
+
+  Byte status = SERVE_OK;
+  uint64_t output_size = 0;
+  void *mapped = MAP_FAILED;
+  struct stat in_stat;
+  try {
+    if ((operation & ~SERVE_FDS) > SERVE_DECOMPRESS || level > MAX_LEVEL)
+      exit_with_error("Unknown request");
+
+    // File descriptor requests map the input, the output is written from
+    // the start of the output file, which is then cut to its size
+    const Byte *data = input.data();
+    if (operation & SERVE_FDS) {
+      if (fds.size() != 2 || size)
+        exit_with_error("Expected an input and an output file descriptor");
+      if (fstat(fds[0], &in_stat) < 0)
+        exit_with_error(std::string("Could not read input: ") +
+                        std::strerror(errno));
+
+      size = in_stat.st_size;
+      if (size) {
+        mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fds[0], 0);
+        if (mapped == MAP_FAILED)
+          exit_with_error(std::string("Could not map input: ") +
+                          std::strerror(errno));
+        data = static_cast<const Byte *>(mapped);
+      }
+    }
+
+    if ((operation & ~SERVE_FDS) == SERVE_COMPRESS) {
+      Options request_options = options;
+      if (level)
+        request_options.level = level;
+      compress_buffer(data, size, effective_level(request_options), output);
+    } else {
+      decompress_buffer(data, size, output);
+    }
+    output_size = output.size();
+
+    if (operation & SERVE_FDS) {
+      write_fully(fds[1], output.data(), output.size(), 0);
+      if (ftruncate(fds[1], output.size()) < 0)
+        exit_with_error(std::string("Could not size output: ") +
+                        std::strerror(errno));
+      output.clear();
+    }
+  } catch (const std::exception &error) {
+    // Also catches allocations that fail on sizes read from corrupt input
+    status = SERVE_FAILED;
+    std::string message = error.what();
+    output.assign(message.begin(), message.end());
+    output_size = output.size();
+  }
+
+  if (mapped != MAP_FAILED)
+    munmap(mapped, size);
+  for (int passed : fds) {
+    close(passed);
+  }
+
+  return send_response(fd, status, output_size, output);
+}
+
+bool receive_fully(int fd, Byte *buffer, size_t size, std::vector<int> &fds) {
+  while (size) {
+    iovec part = {buffer, size};
+    alignas(cmsghdr) char control[CMSG_SPACE(2 * sizeof(int))];
+    msghdr message = {};
+    message.msg_iov = &part;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    ssize_t received = recvmsg(fd, &message, 0);
+    if (received < 0 && errno == EINTR)
+      continue;
+    if (received <= 0)
+      return false;
+
+    // Descriptors beyond what fits are closed by the kernel
+    for (cmsghdr *header = CMSG_FIRSTHDR(&message); header;
+         header = CMSG_NXTHDR(&message, header)) {
+      if (header->cmsg_level != SOL_SOCKET || header->cmsg_type != SCM_RIGHTS)
+        continue;
+      size_t count = (header->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+      for (size_t i = 0; i < count; ++i) {
+        int passed;
+        std::memcpy(&passed, CMSG_DATA(header) + i * sizeof(int), sizeof(int));
+        fds.push_back(passed);
+      }
+    }
+
+    buffer += received;
+    size -= received;
+  }
+
+  return true;
+}
+
+bool send_response(int fd, Byte status, uint64_t size,
+                   const std::vector<Byte> &body) {
+  std::vector<Byte> header;
+  put_value(header, status);
+  put_value(header, size);
 
-  std::string bits = bytes_to_bit_string(data);
-  std::vector<Byte> decompressed = decompress(bits, padding, frequencies);
+  // The header and body go out in one call where the socket takes them
+  iovec parts[2] = {{header.data(), header.size()},
+                    {const_cast<Byte *>(body.data()), body.size()}};
+  int first = 0;
+  while (first < 2) {
+    ssize_t sent = writev(fd, parts + first, 2 - first);
+    if (sent < 0 && errno == EINTR)
+      continue;
+    if (sent < 0)
+      return false;
+
+    for (; first < 2 && size_t(sent) >= parts[first].iov_len; ++first) {
+      sent -= parts[first].iov_len;
+    }
+    if (first < 2) {
+      parts[first].iov_base = static_cast<Byte *>(parts[first].iov_base) + sent;
+      parts[first].iov_len -= sent;
+    }
+  }
 
-  write_uncompressed_file(decompressed, to_file);
+  return true;
 }
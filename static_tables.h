@@ -0,0 +1,1816 @@
+// Generated by ./huffman --generate-tables from corpus/text.txt corpus/json.json corpus/binary.bin, do not edit
+
+constexpr Byte STATIC_CODE_LENGTHS[STATIC_TABLES][UCHAR_MAX + 1] = {
+    {
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 6, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        3, 14, 8, 15, 15, 14, 15, 12, 9, 9, 15, 15, 6, 9, 7, 10,
+        10, 11, 11, 11, 12, 12, 13, 13, 12, 12, 11, 11, 14, 15, 14, 15,
+        15, 9, 10, 8, 8, 9, 9, 10, 10, 8, 13, 12, 8, 9, 9, 9,
+        10, 14, 10, 8, 8, 10, 10, 9, 11, 9, 12, 13, 15, 13, 15, 15,
+        15, 4, 6, 5, 5, 4, 6, 7, 5, 4, 11, 8, 5, 6, 4, 4,
+        6, 10, 4, 4, 4, 5, 7, 7, 8, 6, 12, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    },
+    {
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 4, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        1, 15, 4, 9, 8, 15, 15, 14, 11, 11, 11, 13, 6, 9, 10, 8,
+        11, 12, 13, 14, 14, 15, 14, 15, 14, 12, 6, 15, 13, 13, 13, 12,
+        15, 11, 11, 11, 10, 15, 10, 15, 15, 9, 15, 15, 10, 13, 13, 9,
+        9, 15, 13, 11, 9, 13, 11, 12, 15, 15, 12, 8, 10, 8, 14, 9,
+        10, 6, 8, 7, 6, 5, 7, 7, 8, 6, 10, 9, 6, 7, 5, 6,
+        6, 12, 6, 6, 5, 7, 10, 9, 11, 7, 12, 7, 12, 7, 15, 15,
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    },
+    {
+        2, 6, 7, 8, 7, 8, 9, 8, 6, 8, 8, 8, 8, 9, 7, 5,
+        7, 8, 9, 9, 8, 9, 10, 8, 8, 10, 9, 9, 9, 10, 11, 8,
+        8, 10, 10, 10, 6, 10, 11, 11, 8, 8, 10, 10, 10, 10, 9, 11,
+        8, 8, 9, 9, 9, 10, 10, 11, 8, 8, 10, 10, 9, 10, 10, 9,
+        8, 6, 8, 9, 6, 7, 9, 8, 5, 7, 10, 9, 7, 8, 10, 10,
+        9, 10, 10, 9, 8, 9, 9, 9, 10, 11, 10, 9, 8, 9, 10, 9,
+        9, 9, 10, 9, 9, 8, 7, 10, 9, 9, 10, 10, 9, 10, 9, 9,
+        9, 10, 8, 9, 7, 8, 10, 9, 9, 10, 10, 9, 9, 9, 10, 9,
+        9, 9, 10, 6, 7, 7, 9, 10, 8, 5, 11, 6, 9, 7, 10, 10,
+        9, 11, 11, 10, 10, 10, 11, 10, 10, 11, 10, 11, 11, 11, 11, 11,
+        10, 11, 11, 10, 11, 10, 11, 11, 10, 11, 11, 10, 10, 11, 10, 10,
+        10, 10, 11, 10, 10, 11, 8, 8, 9, 10, 9, 10, 9, 10, 10, 10,
+        7, 8, 9, 8, 9, 9, 9, 8, 9, 9, 10, 10, 10, 10, 10, 10,
+        8, 9, 9, 8, 10, 10, 9, 9, 10, 10, 10, 10, 10, 10, 10, 9,
+        9, 10, 9, 10, 10, 10, 10, 10, 8, 7, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 10, 10, 8, 9, 8, 9, 9, 9, 9, 9, 8, 5,
+    },
+};
+
+constexpr uint32_t STATIC_CODES[STATIC_TABLES][UCHAR_MAX + 1] = {
+    {
+        32594, 32595, 32596, 32597, 32598, 32599, 32600, 32601,
+        32602, 32603, 50, 32604, 32605, 32606, 32607, 32608,
+        32609, 32610, 32611, 32612, 32613, 32614, 32615, 32616,
+        32617, 32618, 32619, 32620, 32621, 32622, 32623, 32624,
+        0, 16290, 236, 32625, 32626, 16291, 32627, 4062,
+        490, 491, 32628, 32629, 51, 492, 114, 1002,
+        1003, 2024, 2025, 2026, 4063, 4064, 8140, 8141,
+        4065, 4066, 2027, 2028, 16292, 32630, 16293, 32631,
+        32632, 493, 1004, 237, 238, 494, 495, 1005,
+        1006, 239, 8142, 4067, 240, 496, 497, 498,
+        1007, 16294, 1008, 241, 242, 1009, 1010, 499,
+        2029, 500, 4068, 8143, 32633, 8144, 32634, 32635,
+        32636, 2, 52, 20, 21, 3, 53, 115,
+        22, 4, 2030, 243, 23, 54, 5, 6,
+        55, 1011, 7, 8, 9, 24, 116, 117,
+        244, 56, 4069, 32637, 32638, 32639, 32640, 32641,
+        32642, 32643, 32644, 32645, 32646, 16295, 16296, 32647,
+        32648, 32649, 32650, 32651, 32652, 32653, 32654, 32655,
+        32656, 32657, 32658, 32659, 32660, 32661, 32662, 32663,
+        32664, 32665, 32666, 32667, 32668, 32669, 32670, 32671,
+        32672, 32673, 32674, 32675, 32676, 32677, 32678, 32679,
+        32680, 32681, 32682, 32683, 32684, 32685, 32686, 32687,
+        32688, 32689, 32690, 32691, 32692, 32693, 32694, 32695,
+        32696, 32697, 32698, 32699, 32700, 32701, 32702, 32703,
+        32704, 32705, 32706, 32707, 32708, 32709, 32710, 32711,
+        32712, 32713, 32714, 32715, 32716, 32717, 32718, 32719,
+        32720, 32721, 32722, 32723, 32724, 32725, 32726, 32727,
+        32728, 32729, 32730, 32731, 32732, 32733, 32734, 32735,
+        32736, 32737, 32738, 32739, 32740, 32741, 32742, 32743,
+        32744, 32745, 32746, 32747, 32748, 32749, 32750, 32751,
+        32752, 32753, 32754, 32755, 32756, 32757, 32758, 32759,
+        32760, 32761, 32762, 32763, 32764, 32765, 32766, 32767,
+    },
+    {
+        32592, 32593, 32594, 32595, 32596, 32597, 32598, 32599,
+        32600, 32601, 8, 32602, 32603, 32604, 32605, 32606,
+        32607, 32608, 32609, 32610, 32611, 32612, 32613, 32614,
+        32615, 32616, 32617, 32618, 32619, 32620, 32621, 32622,
+        0, 32623, 9, 492, 240, 32624, 32625, 16290,
+        2020, 2021, 2022, 8136, 46, 493, 1002, 241,
+        2023, 4060, 8137, 16291, 16292, 32626, 16293, 32627,
+        16294, 4061, 47, 32628, 8138, 8139, 8140, 4062,
+        32629, 2024, 2025, 2026, 1003, 32630, 1004, 32631,
+        32632, 494, 32633, 32634, 1005, 8141, 8142, 495,
+        496, 32635, 8143, 2027, 497, 8144, 2028, 4063,
+        32636, 32637, 4064, 242, 1006, 243, 16295, 498,
+        1007, 48, 244, 112, 49, 20, 113, 114,
+        245, 50, 1008, 499, 51, 115, 21, 52,
+        53, 4065, 54, 55, 22, 116, 1009, 500,
+        2029, 117, 4066, 118, 4067, 119, 32638, 32639,
+        32640, 32641, 32642, 32643, 32644, 32645, 32646, 32647,
+        32648, 32649, 32650, 32651, 32652, 32653, 32654, 32655,
+        32656, 32657, 32658, 32659, 32660, 32661, 32662, 32663,
+        32664, 32665, 32666, 32667, 32668, 32669, 32670, 32671,
+        32672, 32673, 32674, 32675, 32676, 32677, 32678, 32679,
+        32680, 32681, 32682, 32683, 32684, 32685, 32686, 32687,
+        32688, 32689, 32690, 32691, 32692, 32693, 32694, 32695,
+        32696, 32697, 32698, 32699, 32700, 32701, 32702, 32703,
+        32704, 32705, 32706, 32707, 32708, 32709, 32710, 32711,
+        32712, 32713, 32714, 32715, 32716, 32717, 32718, 32719,
+        32720, 32721, 32722, 32723, 32724, 32725, 32726, 32727,
+        32728, 32729, 32730, 32731, 32732, 32733, 32734, 32735,
+        32736, 32737, 32738, 32739, 32740, 32741, 32742, 32743,
+        32744, 32745, 32746, 32747, 32748, 32749, 32750, 32751,
+        32752, 32753, 32754, 32755, 32756, 32757, 32758, 32759,
+        32760, 32761, 32762, 32763, 32764, 32765, 32766, 32767,
+    },
+    {
+        0, 24, 62, 152, 63, 153, 384, 154,
+        25, 155, 156, 157, 158, 385, 64, 8,
+        65, 159, 386, 387, 160, 388, 926, 161,
+        162, 927, 389, 390, 391, 928, 2022, 163,
+        164, 929, 930, 931, 26, 932, 2023, 2024,
+        165, 166, 933, 934, 935, 936, 392, 2025,
+        167, 168, 393, 394, 395, 937, 938, 2026,
+        169, 170, 939, 940, 396, 941, 942, 397,
+        171, 27, 172, 398, 28, 66, 399, 173,
+        9, 67, 943, 400, 68, 174, 944, 945,
+        401, 946, 947, 402, 175, 403, 404, 405,
+        948, 2027, 949, 406, 176, 407, 950, 408,
+        409, 410, 951, 411, 412, 177, 69, 952,
+        413, 414, 953, 954, 415, 955, 416, 417,
+        418, 956, 178, 419, 70, 179, 957, 420,
+        421, 958, 959, 422, 423, 424, 960, 425,
+        426, 427, 961, 29, 71, 72, 428, 962,
+        180, 10, 2028, 30, 429, 73, 963, 964,
+        430, 2029, 2030, 965, 966, 967, 2031, 968,
+        969, 2032, 970, 2033, 2034, 2035, 2036, 2037,
+        971, 2038, 2039, 972, 2040, 973, 2041, 2042,
+        974, 2043, 2044, 975, 976, 2045, 977, 978,
+        979, 980, 2046, 981, 982, 2047, 181, 182,
+        431, 983, 432, 984, 433, 985, 986, 987,
+        74, 183, 434, 184, 435, 436, 437, 185,
+        438, 439, 988, 989, 990, 991, 992, 993,
+        186, 440, 441, 187, 994, 995, 442, 443,
+        996, 997, 998, 999, 1000, 1001, 1002, 444,
+        445, 1003, 446, 1004, 1005, 1006, 1007, 1008,
+        188, 75, 447, 448, 449, 450, 451, 452,
+        453, 454, 455, 456, 1009, 1010, 189, 457,
+        190, 458, 459, 460, 461, 462, 191, 11,
+    },
+};
+
+constexpr DecodeEntry STATIC_DECODE_TABLE_0[] = {
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {32, 3, 0}, {32, 3, 0}, {32, 3, 0}, {32, 3, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {97, 4, 0}, {97, 4, 0}, {97, 4, 0}, {97, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {101, 4, 0}, {101, 4, 0}, {101, 4, 0}, {101, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {105, 4, 0}, {105, 4, 0}, {105, 4, 0}, {105, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {110, 4, 0}, {110, 4, 0}, {110, 4, 0}, {110, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {111, 4, 0}, {111, 4, 0}, {111, 4, 0}, {111, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {114, 4, 0}, {114, 4, 0}, {114, 4, 0}, {114, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {115, 4, 0}, {115, 4, 0}, {115, 4, 0}, {115, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {116, 4, 0}, {116, 4, 0}, {116, 4, 0}, {116, 4, 0},
+    {99, 5, 0}, {99, 5, 0}, {99, 5, 0}, {99, 5, 0},
+    {99, 5, 0}, {99, 5, 0}, {99, 5, 0}, {99, 5, 0},
+    {99, 5, 0}, {99, 5, 0}, {99, 5, 0}, {99, 5, 0},
+    {99, 5, 0}, {99, 5, 0}, {99, 5, 0}, {99, 5, 0},
+    {99, 5, 0}, {99, 5, 0}, {99, 5, 0}, {99, 5, 0},
+    {99, 5, 0}, {99, 5, 0}, {99, 5, 0}, {99, 5, 0},
+    {99, 5, 0}, {99, 5, 0}, {99, 5, 0}, {99, 5, 0},
+    {99, 5, 0}, {99, 5, 0}, {99, 5, 0}, {99, 5, 0},
+    {99, 5, 0}, {99, 5, 0}, {99, 5, 0}, {99, 5, 0},
+    {99, 5, 0}, {99, 5, 0}, {99, 5, 0}, {99, 5, 0},
+    {99, 5, 0}, {99, 5, 0}, {99, 5, 0}, {99, 5, 0},
+    {99, 5, 0}, {99, 5, 0}, {99, 5, 0}, {99, 5, 0},
+    {99, 5, 0}, {99, 5, 0}, {99, 5, 0}, {99, 5, 0},
+    {99, 5, 0}, {99, 5, 0}, {99, 5, 0}, {99, 5, 0},
+    {99, 5, 0}, {99, 5, 0}, {99, 5, 0}, {99, 5, 0},
+    {99, 5, 0}, {99, 5, 0}, {99, 5, 0}, {99, 5, 0},
+    {100, 5, 0}, {100, 5, 0}, {100, 5, 0}, {100, 5, 0},
+    {100, 5, 0}, {100, 5, 0}, {100, 5, 0}, {100, 5, 0},
+    {100, 5, 0}, {100, 5, 0}, {100, 5, 0}, {100, 5, 0},
+    {100, 5, 0}, {100, 5, 0}, {100, 5, 0}, {100, 5, 0},
+    {100, 5, 0}, {100, 5, 0}, {100, 5, 0}, {100, 5, 0},
+    {100, 5, 0}, {100, 5, 0}, {100, 5, 0}, {100, 5, 0},
+    {100, 5, 0}, {100, 5, 0}, {100, 5, 0}, {100, 5, 0},
+    {100, 5, 0}, {100, 5, 0}, {100, 5, 0}, {100, 5, 0},
+    {100, 5, 0}, {100, 5, 0}, {100, 5, 0}, {100, 5, 0},
+    {100, 5, 0}, {100, 5, 0}, {100, 5, 0}, {100, 5, 0},
+    {100, 5, 0}, {100, 5, 0}, {100, 5, 0}, {100, 5, 0},
+    {100, 5, 0}, {100, 5, 0}, {100, 5, 0}, {100, 5, 0},
+    {100, 5, 0}, {100, 5, 0}, {100, 5, 0}, {100, 5, 0},
+    {100, 5, 0}, {100, 5, 0}, {100, 5, 0}, {100, 5, 0},
+    {100, 5, 0}, {100, 5, 0}, {100, 5, 0}, {100, 5, 0},
+    {100, 5, 0}, {100, 5, 0}, {100, 5, 0}, {100, 5, 0},
+    {104, 5, 0}, {104, 5, 0}, {104, 5, 0}, {104, 5, 0},
+    {104, 5, 0}, {104, 5, 0}, {104, 5, 0}, {104, 5, 0},
+    {104, 5, 0}, {104, 5, 0}, {104, 5, 0}, {104, 5, 0},
+    {104, 5, 0}, {104, 5, 0}, {104, 5, 0}, {104, 5, 0},
+    {104, 5, 0}, {104, 5, 0}, {104, 5, 0}, {104, 5, 0},
+    {104, 5, 0}, {104, 5, 0}, {104, 5, 0}, {104, 5, 0},
+    {104, 5, 0}, {104, 5, 0}, {104, 5, 0}, {104, 5, 0},
+    {104, 5, 0}, {104, 5, 0}, {104, 5, 0}, {104, 5, 0},
+    {104, 5, 0}, {104, 5, 0}, {104, 5, 0}, {104, 5, 0},
+    {104, 5, 0}, {104, 5, 0}, {104, 5, 0}, {104, 5, 0},
+    {104, 5, 0}, {104, 5, 0}, {104, 5, 0}, {104, 5, 0},
+    {104, 5, 0}, {104, 5, 0}, {104, 5, 0}, {104, 5, 0},
+    {104, 5, 0}, {104, 5, 0}, {104, 5, 0}, {104, 5, 0},
+    {104, 5, 0}, {104, 5, 0}, {104, 5, 0}, {104, 5, 0},
+    {104, 5, 0}, {104, 5, 0}, {104, 5, 0}, {104, 5, 0},
+    {104, 5, 0}, {104, 5, 0}, {104, 5, 0}, {104, 5, 0},
+    {108, 5, 0}, {108, 5, 0}, {108, 5, 0}, {108, 5, 0},
+    {108, 5, 0}, {108, 5, 0}, {108, 5, 0}, {108, 5, 0},
+    {108, 5, 0}, {108, 5, 0}, {108, 5, 0}, {108, 5, 0},
+    {108, 5, 0}, {108, 5, 0}, {108, 5, 0}, {108, 5, 0},
+    {108, 5, 0}, {108, 5, 0}, {108, 5, 0}, {108, 5, 0},
+    {108, 5, 0}, {108, 5, 0}, {108, 5, 0}, {108, 5, 0},
+    {108, 5, 0}, {108, 5, 0}, {108, 5, 0}, {108, 5, 0},
+    {108, 5, 0}, {108, 5, 0}, {108, 5, 0}, {108, 5, 0},
+    {108, 5, 0}, {108, 5, 0}, {108, 5, 0}, {108, 5, 0},
+    {108, 5, 0}, {108, 5, 0}, {108, 5, 0}, {108, 5, 0},
+    {108, 5, 0}, {108, 5, 0}, {108, 5, 0}, {108, 5, 0},
+    {108, 5, 0}, {108, 5, 0}, {108, 5, 0}, {108, 5, 0},
+    {108, 5, 0}, {108, 5, 0}, {108, 5, 0}, {108, 5, 0},
+    {108, 5, 0}, {108, 5, 0}, {108, 5, 0}, {108, 5, 0},
+    {108, 5, 0}, {108, 5, 0}, {108, 5, 0}, {108, 5, 0},
+    {108, 5, 0}, {108, 5, 0}, {108, 5, 0}, {108, 5, 0},
+    {117, 5, 0}, {117, 5, 0}, {117, 5, 0}, {117, 5, 0},
+    {117, 5, 0}, {117, 5, 0}, {117, 5, 0}, {117, 5, 0},
+    {117, 5, 0}, {117, 5, 0}, {117, 5, 0}, {117, 5, 0},
+    {117, 5, 0}, {117, 5, 0}, {117, 5, 0}, {117, 5, 0},
+    {117, 5, 0}, {117, 5, 0}, {117, 5, 0}, {117, 5, 0},
+    {117, 5, 0}, {117, 5, 0}, {117, 5, 0}, {117, 5, 0},
+    {117, 5, 0}, {117, 5, 0}, {117, 5, 0}, {117, 5, 0},
+    {117, 5, 0}, {117, 5, 0}, {117, 5, 0}, {117, 5, 0},
+    {117, 5, 0}, {117, 5, 0}, {117, 5, 0}, {117, 5, 0},
+    {117, 5, 0}, {117, 5, 0}, {117, 5, 0}, {117, 5, 0},
+    {117, 5, 0}, {117, 5, 0}, {117, 5, 0}, {117, 5, 0},
+    {117, 5, 0}, {117, 5, 0}, {117, 5, 0}, {117, 5, 0},
+    {117, 5, 0}, {117, 5, 0}, {117, 5, 0}, {117, 5, 0},
+    {117, 5, 0}, {117, 5, 0}, {117, 5, 0}, {117, 5, 0},
+    {117, 5, 0}, {117, 5, 0}, {117, 5, 0}, {117, 5, 0},
+    {117, 5, 0}, {117, 5, 0}, {117, 5, 0}, {117, 5, 0},
+    {10, 6, 0}, {10, 6, 0}, {10, 6, 0}, {10, 6, 0},
+    {10, 6, 0}, {10, 6, 0}, {10, 6, 0}, {10, 6, 0},
+    {10, 6, 0}, {10, 6, 0}, {10, 6, 0}, {10, 6, 0},
+    {10, 6, 0}, {10, 6, 0}, {10, 6, 0}, {10, 6, 0},
+    {10, 6, 0}, {10, 6, 0}, {10, 6, 0}, {10, 6, 0},
+    {10, 6, 0}, {10, 6, 0}, {10, 6, 0}, {10, 6, 0},
+    {10, 6, 0}, {10, 6, 0}, {10, 6, 0}, {10, 6, 0},
+    {10, 6, 0}, {10, 6, 0}, {10, 6, 0}, {10, 6, 0},
+    {44, 6, 0}, {44, 6, 0}, {44, 6, 0}, {44, 6, 0},
+    {44, 6, 0}, {44, 6, 0}, {44, 6, 0}, {44, 6, 0},
+    {44, 6, 0}, {44, 6, 0}, {44, 6, 0}, {44, 6, 0},
+    {44, 6, 0}, {44, 6, 0}, {44, 6, 0}, {44, 6, 0},
+    {44, 6, 0}, {44, 6, 0}, {44, 6, 0}, {44, 6, 0},
+    {44, 6, 0}, {44, 6, 0}, {44, 6, 0}, {44, 6, 0},
+    {44, 6, 0}, {44, 6, 0}, {44, 6, 0}, {44, 6, 0},
+    {44, 6, 0}, {44, 6, 0}, {44, 6, 0}, {44, 6, 0},
+    {98, 6, 0}, {98, 6, 0}, {98, 6, 0}, {98, 6, 0},
+    {98, 6, 0}, {98, 6, 0}, {98, 6, 0}, {98, 6, 0},
+    {98, 6, 0}, {98, 6, 0}, {98, 6, 0}, {98, 6, 0},
+    {98, 6, 0}, {98, 6, 0}, {98, 6, 0}, {98, 6, 0},
+    {98, 6, 0}, {98, 6, 0}, {98, 6, 0}, {98, 6, 0},
+    {98, 6, 0}, {98, 6, 0}, {98, 6, 0}, {98, 6, 0},
+    {98, 6, 0}, {98, 6, 0}, {98, 6, 0}, {98, 6, 0},
+    {98, 6, 0}, {98, 6, 0}, {98, 6, 0}, {98, 6, 0},
+    {102, 6, 0}, {102, 6, 0}, {102, 6, 0}, {102, 6, 0},
+    {102, 6, 0}, {102, 6, 0}, {102, 6, 0}, {102, 6, 0},
+    {102, 6, 0}, {102, 6, 0}, {102, 6, 0}, {102, 6, 0},
+    {102, 6, 0}, {102, 6, 0}, {102, 6, 0}, {102, 6, 0},
+    {102, 6, 0}, {102, 6, 0}, {102, 6, 0}, {102, 6, 0},
+    {102, 6, 0}, {102, 6, 0}, {102, 6, 0}, {102, 6, 0},
+    {102, 6, 0}, {102, 6, 0}, {102, 6, 0}, {102, 6, 0},
+    {102, 6, 0}, {102, 6, 0}, {102, 6, 0}, {102, 6, 0},
+    {109, 6, 0}, {109, 6, 0}, {109, 6, 0}, {109, 6, 0},
+    {109, 6, 0}, {109, 6, 0}, {109, 6, 0}, {109, 6, 0},
+    {109, 6, 0}, {109, 6, 0}, {109, 6, 0}, {109, 6, 0},
+    {109, 6, 0}, {109, 6, 0}, {109, 6, 0}, {109, 6, 0},
+    {109, 6, 0}, {109, 6, 0}, {109, 6, 0}, {109, 6, 0},
+    {109, 6, 0}, {109, 6, 0}, {109, 6, 0}, {109, 6, 0},
+    {109, 6, 0}, {109, 6, 0}, {109, 6, 0}, {109, 6, 0},
+    {109, 6, 0}, {109, 6, 0}, {109, 6, 0}, {109, 6, 0},
+    {112, 6, 0}, {112, 6, 0}, {112, 6, 0}, {112, 6, 0},
+    {112, 6, 0}, {112, 6, 0}, {112, 6, 0}, {112, 6, 0},
+    {112, 6, 0}, {112, 6, 0}, {112, 6, 0}, {112, 6, 0},
+    {112, 6, 0}, {112, 6, 0}, {112, 6, 0}, {112, 6, 0},
+    {112, 6, 0}, {112, 6, 0}, {112, 6, 0}, {112, 6, 0},
+    {112, 6, 0}, {112, 6, 0}, {112, 6, 0}, {112, 6, 0},
+    {112, 6, 0}, {112, 6, 0}, {112, 6, 0}, {112, 6, 0},
+    {112, 6, 0}, {112, 6, 0}, {112, 6, 0}, {112, 6, 0},
+    {121, 6, 0}, {121, 6, 0}, {121, 6, 0}, {121, 6, 0},
+    {121, 6, 0}, {121, 6, 0}, {121, 6, 0}, {121, 6, 0},
+    {121, 6, 0}, {121, 6, 0}, {121, 6, 0}, {121, 6, 0},
+    {121, 6, 0}, {121, 6, 0}, {121, 6, 0}, {121, 6, 0},
+    {121, 6, 0}, {121, 6, 0}, {121, 6, 0}, {121, 6, 0},
+    {121, 6, 0}, {121, 6, 0}, {121, 6, 0}, {121, 6, 0},
+    {121, 6, 0}, {121, 6, 0}, {121, 6, 0}, {121, 6, 0},
+    {121, 6, 0}, {121, 6, 0}, {121, 6, 0}, {121, 6, 0},
+    {46, 7, 0}, {46, 7, 0}, {46, 7, 0}, {46, 7, 0},
+    {46, 7, 0}, {46, 7, 0}, {46, 7, 0}, {46, 7, 0},
+    {46, 7, 0}, {46, 7, 0}, {46, 7, 0}, {46, 7, 0},
+    {46, 7, 0}, {46, 7, 0}, {46, 7, 0}, {46, 7, 0},
+    {103, 7, 0}, {103, 7, 0}, {103, 7, 0}, {103, 7, 0},
+    {103, 7, 0}, {103, 7, 0}, {103, 7, 0}, {103, 7, 0},
+    {103, 7, 0}, {103, 7, 0}, {103, 7, 0}, {103, 7, 0},
+    {103, 7, 0}, {103, 7, 0}, {103, 7, 0}, {103, 7, 0},
+    {118, 7, 0}, {118, 7, 0}, {118, 7, 0}, {118, 7, 0},
+    {118, 7, 0}, {118, 7, 0}, {118, 7, 0}, {118, 7, 0},
+    {118, 7, 0}, {118, 7, 0}, {118, 7, 0}, {118, 7, 0},
+    {118, 7, 0}, {118, 7, 0}, {118, 7, 0}, {118, 7, 0},
+    {119, 7, 0}, {119, 7, 0}, {119, 7, 0}, {119, 7, 0},
+    {119, 7, 0}, {119, 7, 0}, {119, 7, 0}, {119, 7, 0},
+    {119, 7, 0}, {119, 7, 0}, {119, 7, 0}, {119, 7, 0},
+    {119, 7, 0}, {119, 7, 0}, {119, 7, 0}, {119, 7, 0},
+    {34, 8, 0}, {34, 8, 0}, {34, 8, 0}, {34, 8, 0},
+    {34, 8, 0}, {34, 8, 0}, {34, 8, 0}, {34, 8, 0},
+    {67, 8, 0}, {67, 8, 0}, {67, 8, 0}, {67, 8, 0},
+    {67, 8, 0}, {67, 8, 0}, {67, 8, 0}, {67, 8, 0},
+    {68, 8, 0}, {68, 8, 0}, {68, 8, 0}, {68, 8, 0},
+    {68, 8, 0}, {68, 8, 0}, {68, 8, 0}, {68, 8, 0},
+    {73, 8, 0}, {73, 8, 0}, {73, 8, 0}, {73, 8, 0},
+    {73, 8, 0}, {73, 8, 0}, {73, 8, 0}, {73, 8, 0},
+    {76, 8, 0}, {76, 8, 0}, {76, 8, 0}, {76, 8, 0},
+    {76, 8, 0}, {76, 8, 0}, {76, 8, 0}, {76, 8, 0},
+    {83, 8, 0}, {83, 8, 0}, {83, 8, 0}, {83, 8, 0},
+    {83, 8, 0}, {83, 8, 0}, {83, 8, 0}, {83, 8, 0},
+    {84, 8, 0}, {84, 8, 0}, {84, 8, 0}, {84, 8, 0},
+    {84, 8, 0}, {84, 8, 0}, {84, 8, 0}, {84, 8, 0},
+    {107, 8, 0}, {107, 8, 0}, {107, 8, 0}, {107, 8, 0},
+    {107, 8, 0}, {107, 8, 0}, {107, 8, 0}, {107, 8, 0},
+    {120, 8, 0}, {120, 8, 0}, {120, 8, 0}, {120, 8, 0},
+    {120, 8, 0}, {120, 8, 0}, {120, 8, 0}, {120, 8, 0},
+    {40, 9, 0}, {40, 9, 0}, {40, 9, 0}, {40, 9, 0},
+    {41, 9, 0}, {41, 9, 0}, {41, 9, 0}, {41, 9, 0},
+    {45, 9, 0}, {45, 9, 0}, {45, 9, 0}, {45, 9, 0},
+    {65, 9, 0}, {65, 9, 0}, {65, 9, 0}, {65, 9, 0},
+    {69, 9, 0}, {69, 9, 0}, {69, 9, 0}, {69, 9, 0},
+    {70, 9, 0}, {70, 9, 0}, {70, 9, 0}, {70, 9, 0},
+    {77, 9, 0}, {77, 9, 0}, {77, 9, 0}, {77, 9, 0},
+    {78, 9, 0}, {78, 9, 0}, {78, 9, 0}, {78, 9, 0},
+    {79, 9, 0}, {79, 9, 0}, {79, 9, 0}, {79, 9, 0},
+    {87, 9, 0}, {87, 9, 0}, {87, 9, 0}, {87, 9, 0},
+    {89, 9, 0}, {89, 9, 0}, {89, 9, 0}, {89, 9, 0},
+    {47, 10, 0}, {47, 10, 0}, {48, 10, 0}, {48, 10, 0},
+    {66, 10, 0}, {66, 10, 0}, {71, 10, 0}, {71, 10, 0},
+    {72, 10, 0}, {72, 10, 0}, {80, 10, 0}, {80, 10, 0},
+    {82, 10, 0}, {82, 10, 0}, {85, 10, 0}, {85, 10, 0},
+    {86, 10, 0}, {86, 10, 0}, {113, 10, 0}, {113, 10, 0},
+    {49, 11, 0}, {50, 11, 0}, {51, 11, 0}, {58, 11, 0},
+    {59, 11, 0}, {88, 11, 0}, {106, 11, 0}, {2048, 0, 1},
+    {2050, 0, 1}, {2052, 0, 1}, {2054, 0, 1}, {2056, 0, 2},
+    {2060, 0, 3}, {2068, 0, 4}, {2084, 0, 4}, {2100, 0, 4},
+    {2116, 0, 4}, {2132, 0, 4}, {2148, 0, 4}, {2164, 0, 4},
+    {2180, 0, 4}, {2196, 0, 4}, {2212, 0, 4}, {2228, 0, 4},
+    {39, 12, 0}, {52, 12, 0}, {53, 12, 0}, {56, 12, 0},
+    {57, 12, 0}, {75, 12, 0}, {90, 12, 0}, {122, 12, 0},
+    {54, 13, 0}, {55, 13, 0}, {74, 13, 0}, {91, 13, 0},
+    {93, 13, 0}, {93, 13, 0}, {33, 14, 0}, {37, 14, 0},
+    {60, 14, 0}, {62, 14, 0}, {81, 14, 0}, {133, 14, 0},
+    {134, 14, 0}, {134, 14, 0}, {0, 15, 0}, {1, 15, 0},
+    {2, 15, 0}, {3, 15, 0}, {4, 15, 0}, {5, 15, 0},
+    {6, 15, 0}, {7, 15, 0}, {8, 15, 0}, {9, 15, 0},
+    {11, 15, 0}, {12, 15, 0}, {13, 15, 0}, {14, 15, 0},
+    {15, 15, 0}, {16, 15, 0}, {17, 15, 0}, {18, 15, 0},
+    {19, 15, 0}, {20, 15, 0}, {21, 15, 0}, {22, 15, 0},
+    {23, 15, 0}, {24, 15, 0}, {25, 15, 0}, {26, 15, 0},
+    {27, 15, 0}, {28, 15, 0}, {29, 15, 0}, {30, 15, 0},
+    {31, 15, 0}, {35, 15, 0}, {36, 15, 0}, {38, 15, 0},
+    {42, 15, 0}, {43, 15, 0}, {61, 15, 0}, {63, 15, 0},
+    {64, 15, 0}, {92, 15, 0}, {94, 15, 0}, {95, 15, 0},
+    {96, 15, 0}, {123, 15, 0}, {124, 15, 0}, {125, 15, 0},
+    {126, 15, 0}, {127, 15, 0}, {128, 15, 0}, {129, 15, 0},
+    {130, 15, 0}, {131, 15, 0}, {132, 15, 0}, {135, 15, 0},
+    {136, 15, 0}, {137, 15, 0}, {138, 15, 0}, {139, 15, 0},
+    {140, 15, 0}, {141, 15, 0}, {142, 15, 0}, {143, 15, 0},
+    {144, 15, 0}, {145, 15, 0}, {146, 15, 0}, {147, 15, 0},
+    {148, 15, 0}, {149, 15, 0}, {150, 15, 0}, {151, 15, 0},
+    {152, 15, 0}, {153, 15, 0}, {154, 15, 0}, {155, 15, 0},
+    {156, 15, 0}, {157, 15, 0}, {158, 15, 0}, {159, 15, 0},
+    {160, 15, 0}, {161, 15, 0}, {162, 15, 0}, {163, 15, 0},
+    {164, 15, 0}, {165, 15, 0}, {166, 15, 0}, {167, 15, 0},
+    {168, 15, 0}, {169, 15, 0}, {170, 15, 0}, {171, 15, 0},
+    {172, 15, 0}, {173, 15, 0}, {174, 15, 0}, {175, 15, 0},
+    {176, 15, 0}, {177, 15, 0}, {178, 15, 0}, {179, 15, 0},
+    {180, 15, 0}, {181, 15, 0}, {182, 15, 0}, {183, 15, 0},
+    {184, 15, 0}, {185, 15, 0}, {186, 15, 0}, {187, 15, 0},
+    {188, 15, 0}, {189, 15, 0}, {190, 15, 0}, {191, 15, 0},
+    {192, 15, 0}, {193, 15, 0}, {194, 15, 0}, {195, 15, 0},
+    {196, 15, 0}, {197, 15, 0}, {198, 15, 0}, {199, 15, 0},
+    {200, 15, 0}, {201, 15, 0}, {202, 15, 0}, {203, 15, 0},
+    {204, 15, 0}, {205, 15, 0}, {206, 15, 0}, {207, 15, 0},
+    {208, 15, 0}, {209, 15, 0}, {210, 15, 0}, {211, 15, 0},
+    {212, 15, 0}, {213, 15, 0}, {214, 15, 0}, {215, 15, 0},
+    {216, 15, 0}, {217, 15, 0}, {218, 15, 0}, {219, 15, 0},
+    {220, 15, 0}, {221, 15, 0}, {222, 15, 0}, {223, 15, 0},
+    {224, 15, 0}, {225, 15, 0}, {226, 15, 0}, {227, 15, 0},
+    {228, 15, 0}, {229, 15, 0}, {230, 15, 0}, {231, 15, 0},
+    {232, 15, 0}, {233, 15, 0}, {234, 15, 0}, {235, 15, 0},
+    {236, 15, 0}, {237, 15, 0}, {238, 15, 0}, {239, 15, 0},
+    {240, 15, 0}, {241, 15, 0}, {242, 15, 0}, {243, 15, 0},
+    {244, 15, 0}, {245, 15, 0}, {246, 15, 0}, {247, 15, 0},
+    {248, 15, 0}, {249, 15, 0}, {250, 15, 0}, {251, 15, 0},
+    {252, 15, 0}, {253, 15, 0}, {254, 15, 0}, {255, 15, 0},
+};
+
+constexpr DecodeEntry STATIC_DECODE_TABLE_1[] = {
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {32, 1, 0}, {32, 1, 0}, {32, 1, 0}, {32, 1, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {10, 4, 0}, {10, 4, 0}, {10, 4, 0}, {10, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {34, 4, 0}, {34, 4, 0}, {34, 4, 0}, {34, 4, 0},
+    {101, 5, 0}, {101, 5, 0}, {101, 5, 0}, {101, 5, 0},
+    {101, 5, 0}, {101, 5, 0}, {101, 5, 0}, {101, 5, 0},
+    {101, 5, 0}, {101, 5, 0}, {101, 5, 0}, {101, 5, 0},
+    {101, 5, 0}, {101, 5, 0}, {101, 5, 0}, {101, 5, 0},
+    {101, 5, 0}, {101, 5, 0}, {101, 5, 0}, {101, 5, 0},
+    {101, 5, 0}, {101, 5, 0}, {101, 5, 0}, {101, 5, 0},
+    {101, 5, 0}, {101, 5, 0}, {101, 5, 0}, {101, 5, 0},
+    {101, 5, 0}, {101, 5, 0}, {101, 5, 0}, {101, 5, 0},
+    {101, 5, 0}, {101, 5, 0}, {101, 5, 0}, {101, 5, 0},
+    {101, 5, 0}, {101, 5, 0}, {101, 5, 0}, {101, 5, 0},
+    {101, 5, 0}, {101, 5, 0}, {101, 5, 0}, {101, 5, 0},
+    {101, 5, 0}, {101, 5, 0}, {101, 5, 0}, {101, 5, 0},
+    {101, 5, 0}, {101, 5, 0}, {101, 5, 0}, {101, 5, 0},
+    {101, 5, 0}, {101, 5, 0}, {101, 5, 0}, {101, 5, 0},
+    {101, 5, 0}, {101, 5, 0}, {101, 5, 0}, {101, 5, 0},
+    {101, 5, 0}, {101, 5, 0}, {101, 5, 0}, {101, 5, 0},
+    {110, 5, 0}, {110, 5, 0}, {110, 5, 0}, {110, 5, 0},
+    {110, 5, 0}, {110, 5, 0}, {110, 5, 0}, {110, 5, 0},
+    {110, 5, 0}, {110, 5, 0}, {110, 5, 0}, {110, 5, 0},
+    {110, 5, 0}, {110, 5, 0}, {110, 5, 0}, {110, 5, 0},
+    {110, 5, 0}, {110, 5, 0}, {110, 5, 0}, {110, 5, 0},
+    {110, 5, 0}, {110, 5, 0}, {110, 5, 0}, {110, 5, 0},
+    {110, 5, 0}, {110, 5, 0}, {110, 5, 0}, {110, 5, 0},
+    {110, 5, 0}, {110, 5, 0}, {110, 5, 0}, {110, 5, 0},
+    {110, 5, 0}, {110, 5, 0}, {110, 5, 0}, {110, 5, 0},
+    {110, 5, 0}, {110, 5, 0}, {110, 5, 0}, {110, 5, 0},
+    {110, 5, 0}, {110, 5, 0}, {110, 5, 0}, {110, 5, 0},
+    {110, 5, 0}, {110, 5, 0}, {110, 5, 0}, {110, 5, 0},
+    {110, 5, 0}, {110, 5, 0}, {110, 5, 0}, {110, 5, 0},
+    {110, 5, 0}, {110, 5, 0}, {110, 5, 0}, {110, 5, 0},
+    {110, 5, 0}, {110, 5, 0}, {110, 5, 0}, {110, 5, 0},
+    {110, 5, 0}, {110, 5, 0}, {110, 5, 0}, {110, 5, 0},
+    {116, 5, 0}, {116, 5, 0}, {116, 5, 0}, {116, 5, 0},
+    {116, 5, 0}, {116, 5, 0}, {116, 5, 0}, {116, 5, 0},
+    {116, 5, 0}, {116, 5, 0}, {116, 5, 0}, {116, 5, 0},
+    {116, 5, 0}, {116, 5, 0}, {116, 5, 0}, {116, 5, 0},
+    {116, 5, 0}, {116, 5, 0}, {116, 5, 0}, {116, 5, 0},
+    {116, 5, 0}, {116, 5, 0}, {116, 5, 0}, {116, 5, 0},
+    {116, 5, 0}, {116, 5, 0}, {116, 5, 0}, {116, 5, 0},
+    {116, 5, 0}, {116, 5, 0}, {116, 5, 0}, {116, 5, 0},
+    {116, 5, 0}, {116, 5, 0}, {116, 5, 0}, {116, 5, 0},
+    {116, 5, 0}, {116, 5, 0}, {116, 5, 0}, {116, 5, 0},
+    {116, 5, 0}, {116, 5, 0}, {116, 5, 0}, {116, 5, 0},
+    {116, 5, 0}, {116, 5, 0}, {116, 5, 0}, {116, 5, 0},
+    {116, 5, 0}, {116, 5, 0}, {116, 5, 0}, {116, 5, 0},
+    {116, 5, 0}, {116, 5, 0}, {116, 5, 0}, {116, 5, 0},
+    {116, 5, 0}, {116, 5, 0}, {116, 5, 0}, {116, 5, 0},
+    {116, 5, 0}, {116, 5, 0}, {116, 5, 0}, {116, 5, 0},
+    {44, 6, 0}, {44, 6, 0}, {44, 6, 0}, {44, 6, 0},
+    {44, 6, 0}, {44, 6, 0}, {44, 6, 0}, {44, 6, 0},
+    {44, 6, 0}, {44, 6, 0}, {44, 6, 0}, {44, 6, 0},
+    {44, 6, 0}, {44, 6, 0}, {44, 6, 0}, {44, 6, 0},
+    {44, 6, 0}, {44, 6, 0}, {44, 6, 0}, {44, 6, 0},
+    {44, 6, 0}, {44, 6, 0}, {44, 6, 0}, {44, 6, 0},
+    {44, 6, 0}, {44, 6, 0}, {44, 6, 0}, {44, 6, 0},
+    {44, 6, 0}, {44, 6, 0}, {44, 6, 0}, {44, 6, 0},
+    {58, 6, 0}, {58, 6, 0}, {58, 6, 0}, {58, 6, 0},
+    {58, 6, 0}, {58, 6, 0}, {58, 6, 0}, {58, 6, 0},
+    {58, 6, 0}, {58, 6, 0}, {58, 6, 0}, {58, 6, 0},
+    {58, 6, 0}, {58, 6, 0}, {58, 6, 0}, {58, 6, 0},
+    {58, 6, 0}, {58, 6, 0}, {58, 6, 0}, {58, 6, 0},
+    {58, 6, 0}, {58, 6, 0}, {58, 6, 0}, {58, 6, 0},
+    {58, 6, 0}, {58, 6, 0}, {58, 6, 0}, {58, 6, 0},
+    {58, 6, 0}, {58, 6, 0}, {58, 6, 0}, {58, 6, 0},
+    {97, 6, 0}, {97, 6, 0}, {97, 6, 0}, {97, 6, 0},
+    {97, 6, 0}, {97, 6, 0}, {97, 6, 0}, {97, 6, 0},
+    {97, 6, 0}, {97, 6, 0}, {97, 6, 0}, {97, 6, 0},
+    {97, 6, 0}, {97, 6, 0}, {97, 6, 0}, {97, 6, 0},
+    {97, 6, 0}, {97, 6, 0}, {97, 6, 0}, {97, 6, 0},
+    {97, 6, 0}, {97, 6, 0}, {97, 6, 0}, {97, 6, 0},
+    {97, 6, 0}, {97, 6, 0}, {97, 6, 0}, {97, 6, 0},
+    {97, 6, 0}, {97, 6, 0}, {97, 6, 0}, {97, 6, 0},
+    {100, 6, 0}, {100, 6, 0}, {100, 6, 0}, {100, 6, 0},
+    {100, 6, 0}, {100, 6, 0}, {100, 6, 0}, {100, 6, 0},
+    {100, 6, 0}, {100, 6, 0}, {100, 6, 0}, {100, 6, 0},
+    {100, 6, 0}, {100, 6, 0}, {100, 6, 0}, {100, 6, 0},
+    {100, 6, 0}, {100, 6, 0}, {100, 6, 0}, {100, 6, 0},
+    {100, 6, 0}, {100, 6, 0}, {100, 6, 0}, {100, 6, 0},
+    {100, 6, 0}, {100, 6, 0}, {100, 6, 0}, {100, 6, 0},
+    {100, 6, 0}, {100, 6, 0}, {100, 6, 0}, {100, 6, 0},
+    {105, 6, 0}, {105, 6, 0}, {105, 6, 0}, {105, 6, 0},
+    {105, 6, 0}, {105, 6, 0}, {105, 6, 0}, {105, 6, 0},
+    {105, 6, 0}, {105, 6, 0}, {105, 6, 0}, {105, 6, 0},
+    {105, 6, 0}, {105, 6, 0}, {105, 6, 0}, {105, 6, 0},
+    {105, 6, 0}, {105, 6, 0}, {105, 6, 0}, {105, 6, 0},
+    {105, 6, 0}, {105, 6, 0}, {105, 6, 0}, {105, 6, 0},
+    {105, 6, 0}, {105, 6, 0}, {105, 6, 0}, {105, 6, 0},
+    {105, 6, 0}, {105, 6, 0}, {105, 6, 0}, {105, 6, 0},
+    {108, 6, 0}, {108, 6, 0}, {108, 6, 0}, {108, 6, 0},
+    {108, 6, 0}, {108, 6, 0}, {108, 6, 0}, {108, 6, 0},
+    {108, 6, 0}, {108, 6, 0}, {108, 6, 0}, {108, 6, 0},
+    {108, 6, 0}, {108, 6, 0}, {108, 6, 0}, {108, 6, 0},
+    {108, 6, 0}, {108, 6, 0}, {108, 6, 0}, {108, 6, 0},
+    {108, 6, 0}, {108, 6, 0}, {108, 6, 0}, {108, 6, 0},
+    {108, 6, 0}, {108, 6, 0}, {108, 6, 0}, {108, 6, 0},
+    {108, 6, 0}, {108, 6, 0}, {108, 6, 0}, {108, 6, 0},
+    {111, 6, 0}, {111, 6, 0}, {111, 6, 0}, {111, 6, 0},
+    {111, 6, 0}, {111, 6, 0}, {111, 6, 0}, {111, 6, 0},
+    {111, 6, 0}, {111, 6, 0}, {111, 6, 0}, {111, 6, 0},
+    {111, 6, 0}, {111, 6, 0}, {111, 6, 0}, {111, 6, 0},
+    {111, 6, 0}, {111, 6, 0}, {111, 6, 0}, {111, 6, 0},
+    {111, 6, 0}, {111, 6, 0}, {111, 6, 0}, {111, 6, 0},
+    {111, 6, 0}, {111, 6, 0}, {111, 6, 0}, {111, 6, 0},
+    {111, 6, 0}, {111, 6, 0}, {111, 6, 0}, {111, 6, 0},
+    {112, 6, 0}, {112, 6, 0}, {112, 6, 0}, {112, 6, 0},
+    {112, 6, 0}, {112, 6, 0}, {112, 6, 0}, {112, 6, 0},
+    {112, 6, 0}, {112, 6, 0}, {112, 6, 0}, {112, 6, 0},
+    {112, 6, 0}, {112, 6, 0}, {112, 6, 0}, {112, 6, 0},
+    {112, 6, 0}, {112, 6, 0}, {112, 6, 0}, {112, 6, 0},
+    {112, 6, 0}, {112, 6, 0}, {112, 6, 0}, {112, 6, 0},
+    {112, 6, 0}, {112, 6, 0}, {112, 6, 0}, {112, 6, 0},
+    {112, 6, 0}, {112, 6, 0}, {112, 6, 0}, {112, 6, 0},
+    {114, 6, 0}, {114, 6, 0}, {114, 6, 0}, {114, 6, 0},
+    {114, 6, 0}, {114, 6, 0}, {114, 6, 0}, {114, 6, 0},
+    {114, 6, 0}, {114, 6, 0}, {114, 6, 0}, {114, 6, 0},
+    {114, 6, 0}, {114, 6, 0}, {114, 6, 0}, {114, 6, 0},
+    {114, 6, 0}, {114, 6, 0}, {114, 6, 0}, {114, 6, 0},
+    {114, 6, 0}, {114, 6, 0}, {114, 6, 0}, {114, 6, 0},
+    {114, 6, 0}, {114, 6, 0}, {114, 6, 0}, {114, 6, 0},
+    {114, 6, 0}, {114, 6, 0}, {114, 6, 0}, {114, 6, 0},
+    {115, 6, 0}, {115, 6, 0}, {115, 6, 0}, {115, 6, 0},
+    {115, 6, 0}, {115, 6, 0}, {115, 6, 0}, {115, 6, 0},
+    {115, 6, 0}, {115, 6, 0}, {115, 6, 0}, {115, 6, 0},
+    {115, 6, 0}, {115, 6, 0}, {115, 6, 0}, {115, 6, 0},
+    {115, 6, 0}, {115, 6, 0}, {115, 6, 0}, {115, 6, 0},
+    {115, 6, 0}, {115, 6, 0}, {115, 6, 0}, {115, 6, 0},
+    {115, 6, 0}, {115, 6, 0}, {115, 6, 0}, {115, 6, 0},
+    {115, 6, 0}, {115, 6, 0}, {115, 6, 0}, {115, 6, 0},
+    {99, 7, 0}, {99, 7, 0}, {99, 7, 0}, {99, 7, 0},
+    {99, 7, 0}, {99, 7, 0}, {99, 7, 0}, {99, 7, 0},
+    {99, 7, 0}, {99, 7, 0}, {99, 7, 0}, {99, 7, 0},
+    {99, 7, 0}, {99, 7, 0}, {99, 7, 0}, {99, 7, 0},
+    {102, 7, 0}, {102, 7, 0}, {102, 7, 0}, {102, 7, 0},
+    {102, 7, 0}, {102, 7, 0}, {102, 7, 0}, {102, 7, 0},
+    {102, 7, 0}, {102, 7, 0}, {102, 7, 0}, {102, 7, 0},
+    {102, 7, 0}, {102, 7, 0}, {102, 7, 0}, {102, 7, 0},
+    {103, 7, 0}, {103, 7, 0}, {103, 7, 0}, {103, 7, 0},
+    {103, 7, 0}, {103, 7, 0}, {103, 7, 0}, {103, 7, 0},
+    {103, 7, 0}, {103, 7, 0}, {103, 7, 0}, {103, 7, 0},
+    {103, 7, 0}, {103, 7, 0}, {103, 7, 0}, {103, 7, 0},
+    {109, 7, 0}, {109, 7, 0}, {109, 7, 0}, {109, 7, 0},
+    {109, 7, 0}, {109, 7, 0}, {109, 7, 0}, {109, 7, 0},
+    {109, 7, 0}, {109, 7, 0}, {109, 7, 0}, {109, 7, 0},
+    {109, 7, 0}, {109, 7, 0}, {109, 7, 0}, {109, 7, 0},
+    {117, 7, 0}, {117, 7, 0}, {117, 7, 0}, {117, 7, 0},
+    {117, 7, 0}, {117, 7, 0}, {117, 7, 0}, {117, 7, 0},
+    {117, 7, 0}, {117, 7, 0}, {117, 7, 0}, {117, 7, 0},
+    {117, 7, 0}, {117, 7, 0}, {117, 7, 0}, {117, 7, 0},
+    {121, 7, 0}, {121, 7, 0}, {121, 7, 0}, {121, 7, 0},
+    {121, 7, 0}, {121, 7, 0}, {121, 7, 0}, {121, 7, 0},
+    {121, 7, 0}, {121, 7, 0}, {121, 7, 0}, {121, 7, 0},
+    {121, 7, 0}, {121, 7, 0}, {121, 7, 0}, {121, 7, 0},
+    {123, 7, 0}, {123, 7, 0}, {123, 7, 0}, {123, 7, 0},
+    {123, 7, 0}, {123, 7, 0}, {123, 7, 0}, {123, 7, 0},
+    {123, 7, 0}, {123, 7, 0}, {123, 7, 0}, {123, 7, 0},
+    {123, 7, 0}, {123, 7, 0}, {123, 7, 0}, {123, 7, 0},
+    {125, 7, 0}, {125, 7, 0}, {125, 7, 0}, {125, 7, 0},
+    {125, 7, 0}, {125, 7, 0}, {125, 7, 0}, {125, 7, 0},
+    {125, 7, 0}, {125, 7, 0}, {125, 7, 0}, {125, 7, 0},
+    {125, 7, 0}, {125, 7, 0}, {125, 7, 0}, {125, 7, 0},
+    {36, 8, 0}, {36, 8, 0}, {36, 8, 0}, {36, 8, 0},
+    {36, 8, 0}, {36, 8, 0}, {36, 8, 0}, {36, 8, 0},
+    {47, 8, 0}, {47, 8, 0}, {47, 8, 0}, {47, 8, 0},
+    {47, 8, 0}, {47, 8, 0}, {47, 8, 0}, {47, 8, 0},
+    {91, 8, 0}, {91, 8, 0}, {91, 8, 0}, {91, 8, 0},
+    {91, 8, 0}, {91, 8, 0}, {91, 8, 0}, {91, 8, 0},
+    {93, 8, 0}, {93, 8, 0}, {93, 8, 0}, {93, 8, 0},
+    {93, 8, 0}, {93, 8, 0}, {93, 8, 0}, {93, 8, 0},
+    {98, 8, 0}, {98, 8, 0}, {98, 8, 0}, {98, 8, 0},
+    {98, 8, 0}, {98, 8, 0}, {98, 8, 0}, {98, 8, 0},
+    {104, 8, 0}, {104, 8, 0}, {104, 8, 0}, {104, 8, 0},
+    {104, 8, 0}, {104, 8, 0}, {104, 8, 0}, {104, 8, 0},
+    {35, 9, 0}, {35, 9, 0}, {35, 9, 0}, {35, 9, 0},
+    {45, 9, 0}, {45, 9, 0}, {45, 9, 0}, {45, 9, 0},
+    {73, 9, 0}, {73, 9, 0}, {73, 9, 0}, {73, 9, 0},
+    {79, 9, 0}, {79, 9, 0}, {79, 9, 0}, {79, 9, 0},
+    {80, 9, 0}, {80, 9, 0}, {80, 9, 0}, {80, 9, 0},
+    {84, 9, 0}, {84, 9, 0}, {84, 9, 0}, {84, 9, 0},
+    {95, 9, 0}, {95, 9, 0}, {95, 9, 0}, {95, 9, 0},
+    {107, 9, 0}, {107, 9, 0}, {107, 9, 0}, {107, 9, 0},
+    {119, 9, 0}, {119, 9, 0}, {119, 9, 0}, {119, 9, 0},
+    {46, 10, 0}, {46, 10, 0}, {68, 10, 0}, {68, 10, 0},
+    {70, 10, 0}, {70, 10, 0}, {76, 10, 0}, {76, 10, 0},
+    {92, 10, 0}, {92, 10, 0}, {96, 10, 0}, {96, 10, 0},
+    {106, 10, 0}, {106, 10, 0}, {118, 10, 0}, {118, 10, 0},
+    {40, 11, 0}, {41, 11, 0}, {42, 11, 0}, {48, 11, 0},
+    {65, 11, 0}, {66, 11, 0}, {67, 11, 0}, {83, 11, 0},
+    {86, 11, 0}, {120, 11, 0}, {2048, 0, 1}, {2050, 0, 1},
+    {2052, 0, 1}, {2054, 0, 1}, {2056, 0, 2}, {2060, 0, 2},
+    {2064, 0, 3}, {2072, 0, 4}, {2088, 0, 4}, {2104, 0, 4},
+    {2120, 0, 4}, {2136, 0, 4}, {2152, 0, 4}, {2168, 0, 4},
+    {2184, 0, 4}, {2200, 0, 4}, {2216, 0, 4}, {2232, 0, 4},
+    {49, 12, 0}, {57, 12, 0}, {63, 12, 0}, {87, 12, 0},
+    {90, 12, 0}, {113, 12, 0}, {122, 12, 0}, {124, 12, 0},
+    {43, 13, 0}, {50, 13, 0}, {60, 13, 0}, {61, 13, 0},
+    {62, 13, 0}, {77, 13, 0}, {78, 13, 0}, {82, 13, 0},
+    {85, 13, 0}, {85, 13, 0}, {39, 14, 0}, {51, 14, 0},
+    {52, 14, 0}, {54, 14, 0}, {56, 14, 0}, {94, 14, 0},
+    {0, 15, 0}, {1, 15, 0}, {2, 15, 0}, {3, 15, 0},
+    {4, 15, 0}, {5, 15, 0}, {6, 15, 0}, {7, 15, 0},
+    {8, 15, 0}, {9, 15, 0}, {11, 15, 0}, {12, 15, 0},
+    {13, 15, 0}, {14, 15, 0}, {15, 15, 0}, {16, 15, 0},
+    {17, 15, 0}, {18, 15, 0}, {19, 15, 0}, {20, 15, 0},
+    {21, 15, 0}, {22, 15, 0}, {23, 15, 0}, {24, 15, 0},
+    {25, 15, 0}, {26, 15, 0}, {27, 15, 0}, {28, 15, 0},
+    {29, 15, 0}, {30, 15, 0}, {31, 15, 0}, {33, 15, 0},
+    {37, 15, 0}, {38, 15, 0}, {53, 15, 0}, {55, 15, 0},
+    {59, 15, 0}, {64, 15, 0}, {69, 15, 0}, {71, 15, 0},
+    {72, 15, 0}, {74, 15, 0}, {75, 15, 0}, {81, 15, 0},
+    {88, 15, 0}, {89, 15, 0}, {126, 15, 0}, {127, 15, 0},
+    {128, 15, 0}, {129, 15, 0}, {130, 15, 0}, {131, 15, 0},
+    {132, 15, 0}, {133, 15, 0}, {134, 15, 0}, {135, 15, 0},
+    {136, 15, 0}, {137, 15, 0}, {138, 15, 0}, {139, 15, 0},
+    {140, 15, 0}, {141, 15, 0}, {142, 15, 0}, {143, 15, 0},
+    {144, 15, 0}, {145, 15, 0}, {146, 15, 0}, {147, 15, 0},
+    {148, 15, 0}, {149, 15, 0}, {150, 15, 0}, {151, 15, 0},
+    {152, 15, 0}, {153, 15, 0}, {154, 15, 0}, {155, 15, 0},
+    {156, 15, 0}, {157, 15, 0}, {158, 15, 0}, {159, 15, 0},
+    {160, 15, 0}, {161, 15, 0}, {162, 15, 0}, {163, 15, 0},
+    {164, 15, 0}, {165, 15, 0}, {166, 15, 0}, {167, 15, 0},
+    {168, 15, 0}, {169, 15, 0}, {170, 15, 0}, {171, 15, 0},
+    {172, 15, 0}, {173, 15, 0}, {174, 15, 0}, {175, 15, 0},
+    {176, 15, 0}, {177, 15, 0}, {178, 15, 0}, {179, 15, 0},
+    {180, 15, 0}, {181, 15, 0}, {182, 15, 0}, {183, 15, 0},
+    {184, 15, 0}, {185, 15, 0}, {186, 15, 0}, {187, 15, 0},
+    {188, 15, 0}, {189, 15, 0}, {190, 15, 0}, {191, 15, 0},
+    {192, 15, 0}, {193, 15, 0}, {194, 15, 0}, {195, 15, 0},
+    {196, 15, 0}, {197, 15, 0}, {198, 15, 0}, {199, 15, 0},
+    {200, 15, 0}, {201, 15, 0}, {202, 15, 0}, {203, 15, 0},
+    {204, 15, 0}, {205, 15, 0}, {206, 15, 0}, {207, 15, 0},
+    {208, 15, 0}, {209, 15, 0}, {210, 15, 0}, {211, 15, 0},
+    {212, 15, 0}, {213, 15, 0}, {214, 15, 0}, {215, 15, 0},
+    {216, 15, 0}, {217, 15, 0}, {218, 15, 0}, {219, 15, 0},
+    {220, 15, 0}, {221, 15, 0}, {222, 15, 0}, {223, 15, 0},
+    {224, 15, 0}, {225, 15, 0}, {226, 15, 0}, {227, 15, 0},
+    {228, 15, 0}, {229, 15, 0}, {230, 15, 0}, {231, 15, 0},
+    {232, 15, 0}, {233, 15, 0}, {234, 15, 0}, {235, 15, 0},
+    {236, 15, 0}, {237, 15, 0}, {238, 15, 0}, {239, 15, 0},
+    {240, 15, 0}, {241, 15, 0}, {242, 15, 0}, {243, 15, 0},
+    {244, 15, 0}, {245, 15, 0}, {246, 15, 0}, {247, 15, 0},
+    {248, 15, 0}, {249, 15, 0}, {250, 15, 0}, {251, 15, 0},
+    {252, 15, 0}, {253, 15, 0}, {254, 15, 0}, {255, 15, 0},
+};
+
+constexpr DecodeEntry STATIC_DECODE_TABLE_2[] = {
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {0, 2, 0}, {0, 2, 0}, {0, 2, 0}, {0, 2, 0},
+    {15, 5, 0}, {15, 5, 0}, {15, 5, 0}, {15, 5, 0},
+    {15, 5, 0}, {15, 5, 0}, {15, 5, 0}, {15, 5, 0},
+    {15, 5, 0}, {15, 5, 0}, {15, 5, 0}, {15, 5, 0},
+    {15, 5, 0}, {15, 5, 0}, {15, 5, 0}, {15, 5, 0},
+    {15, 5, 0}, {15, 5, 0}, {15, 5, 0}, {15, 5, 0},
+    {15, 5, 0}, {15, 5, 0}, {15, 5, 0}, {15, 5, 0},
+    {15, 5, 0}, {15, 5, 0}, {15, 5, 0}, {15, 5, 0},
+    {15, 5, 0}, {15, 5, 0}, {15, 5, 0}, {15, 5, 0},
+    {15, 5, 0}, {15, 5, 0}, {15, 5, 0}, {15, 5, 0},
+    {15, 5, 0}, {15, 5, 0}, {15, 5, 0}, {15, 5, 0},
+    {15, 5, 0}, {15, 5, 0}, {15, 5, 0}, {15, 5, 0},
+    {15, 5, 0}, {15, 5, 0}, {15, 5, 0}, {15, 5, 0},
+    {15, 5, 0}, {15, 5, 0}, {15, 5, 0}, {15, 5, 0},
+    {15, 5, 0}, {15, 5, 0}, {15, 5, 0}, {15, 5, 0},
+    {15, 5, 0}, {15, 5, 0}, {15, 5, 0}, {15, 5, 0},
+    {15, 5, 0}, {15, 5, 0}, {15, 5, 0}, {15, 5, 0},
+    {72, 5, 0}, {72, 5, 0}, {72, 5, 0}, {72, 5, 0},
+    {72, 5, 0}, {72, 5, 0}, {72, 5, 0}, {72, 5, 0},
+    {72, 5, 0}, {72, 5, 0}, {72, 5, 0}, {72, 5, 0},
+    {72, 5, 0}, {72, 5, 0}, {72, 5, 0}, {72, 5, 0},
+    {72, 5, 0}, {72, 5, 0}, {72, 5, 0}, {72, 5, 0},
+    {72, 5, 0}, {72, 5, 0}, {72, 5, 0}, {72, 5, 0},
+    {72, 5, 0}, {72, 5, 0}, {72, 5, 0}, {72, 5, 0},
+    {72, 5, 0}, {72, 5, 0}, {72, 5, 0}, {72, 5, 0},
+    {72, 5, 0}, {72, 5, 0}, {72, 5, 0}, {72, 5, 0},
+    {72, 5, 0}, {72, 5, 0}, {72, 5, 0}, {72, 5, 0},
+    {72, 5, 0}, {72, 5, 0}, {72, 5, 0}, {72, 5, 0},
+    {72, 5, 0}, {72, 5, 0}, {72, 5, 0}, {72, 5, 0},
+    {72, 5, 0}, {72, 5, 0}, {72, 5, 0}, {72, 5, 0},
+    {72, 5, 0}, {72, 5, 0}, {72, 5, 0}, {72, 5, 0},
+    {72, 5, 0}, {72, 5, 0}, {72, 5, 0}, {72, 5, 0},
+    {72, 5, 0}, {72, 5, 0}, {72, 5, 0}, {72, 5, 0},
+    {137, 5, 0}, {137, 5, 0}, {137, 5, 0}, {137, 5, 0},
+    {137, 5, 0}, {137, 5, 0}, {137, 5, 0}, {137, 5, 0},
+    {137, 5, 0}, {137, 5, 0}, {137, 5, 0}, {137, 5, 0},
+    {137, 5, 0}, {137, 5, 0}, {137, 5, 0}, {137, 5, 0},
+    {137, 5, 0}, {137, 5, 0}, {137, 5, 0}, {137, 5, 0},
+    {137, 5, 0}, {137, 5, 0}, {137, 5, 0}, {137, 5, 0},
+    {137, 5, 0}, {137, 5, 0}, {137, 5, 0}, {137, 5, 0},
+    {137, 5, 0}, {137, 5, 0}, {137, 5, 0}, {137, 5, 0},
+    {137, 5, 0}, {137, 5, 0}, {137, 5, 0}, {137, 5, 0},
+    {137, 5, 0}, {137, 5, 0}, {137, 5, 0}, {137, 5, 0},
+    {137, 5, 0}, {137, 5, 0}, {137, 5, 0}, {137, 5, 0},
+    {137, 5, 0}, {137, 5, 0}, {137, 5, 0}, {137, 5, 0},
+    {137, 5, 0}, {137, 5, 0}, {137, 5, 0}, {137, 5, 0},
+    {137, 5, 0}, {137, 5, 0}, {137, 5, 0}, {137, 5, 0},
+    {137, 5, 0}, {137, 5, 0}, {137, 5, 0}, {137, 5, 0},
+    {137, 5, 0}, {137, 5, 0}, {137, 5, 0}, {137, 5, 0},
+    {255, 5, 0}, {255, 5, 0}, {255, 5, 0}, {255, 5, 0},
+    {255, 5, 0}, {255, 5, 0}, {255, 5, 0}, {255, 5, 0},
+    {255, 5, 0}, {255, 5, 0}, {255, 5, 0}, {255, 5, 0},
+    {255, 5, 0}, {255, 5, 0}, {255, 5, 0}, {255, 5, 0},
+    {255, 5, 0}, {255, 5, 0}, {255, 5, 0}, {255, 5, 0},
+    {255, 5, 0}, {255, 5, 0}, {255, 5, 0}, {255, 5, 0},
+    {255, 5, 0}, {255, 5, 0}, {255, 5, 0}, {255, 5, 0},
+    {255, 5, 0}, {255, 5, 0}, {255, 5, 0}, {255, 5, 0},
+    {255, 5, 0}, {255, 5, 0}, {255, 5, 0}, {255, 5, 0},
+    {255, 5, 0}, {255, 5, 0}, {255, 5, 0}, {255, 5, 0},
+    {255, 5, 0}, {255, 5, 0}, {255, 5, 0}, {255, 5, 0},
+    {255, 5, 0}, {255, 5, 0}, {255, 5, 0}, {255, 5, 0},
+    {255, 5, 0}, {255, 5, 0}, {255, 5, 0}, {255, 5, 0},
+    {255, 5, 0}, {255, 5, 0}, {255, 5, 0}, {255, 5, 0},
+    {255, 5, 0}, {255, 5, 0}, {255, 5, 0}, {255, 5, 0},
+    {255, 5, 0}, {255, 5, 0}, {255, 5, 0}, {255, 5, 0},
+    {1, 6, 0}, {1, 6, 0}, {1, 6, 0}, {1, 6, 0},
+    {1, 6, 0}, {1, 6, 0}, {1, 6, 0}, {1, 6, 0},
+    {1, 6, 0}, {1, 6, 0}, {1, 6, 0}, {1, 6, 0},
+    {1, 6, 0}, {1, 6, 0}, {1, 6, 0}, {1, 6, 0},
+    {1, 6, 0}, {1, 6, 0}, {1, 6, 0}, {1, 6, 0},
+    {1, 6, 0}, {1, 6, 0}, {1, 6, 0}, {1, 6, 0},
+    {1, 6, 0}, {1, 6, 0}, {1, 6, 0}, {1, 6, 0},
+    {1, 6, 0}, {1, 6, 0}, {1, 6, 0}, {1, 6, 0},
+    {8, 6, 0}, {8, 6, 0}, {8, 6, 0}, {8, 6, 0},
+    {8, 6, 0}, {8, 6, 0}, {8, 6, 0}, {8, 6, 0},
+    {8, 6, 0}, {8, 6, 0}, {8, 6, 0}, {8, 6, 0},
+    {8, 6, 0}, {8, 6, 0}, {8, 6, 0}, {8, 6, 0},
+    {8, 6, 0}, {8, 6, 0}, {8, 6, 0}, {8, 6, 0},
+    {8, 6, 0}, {8, 6, 0}, {8, 6, 0}, {8, 6, 0},
+    {8, 6, 0}, {8, 6, 0}, {8, 6, 0}, {8, 6, 0},
+    {8, 6, 0}, {8, 6, 0}, {8, 6, 0}, {8, 6, 0},
+    {36, 6, 0}, {36, 6, 0}, {36, 6, 0}, {36, 6, 0},
+    {36, 6, 0}, {36, 6, 0}, {36, 6, 0}, {36, 6, 0},
+    {36, 6, 0}, {36, 6, 0}, {36, 6, 0}, {36, 6, 0},
+    {36, 6, 0}, {36, 6, 0}, {36, 6, 0}, {36, 6, 0},
+    {36, 6, 0}, {36, 6, 0}, {36, 6, 0}, {36, 6, 0},
+    {36, 6, 0}, {36, 6, 0}, {36, 6, 0}, {36, 6, 0},
+    {36, 6, 0}, {36, 6, 0}, {36, 6, 0}, {36, 6, 0},
+    {36, 6, 0}, {36, 6, 0}, {36, 6, 0}, {36, 6, 0},
+    {65, 6, 0}, {65, 6, 0}, {65, 6, 0}, {65, 6, 0},
+    {65, 6, 0}, {65, 6, 0}, {65, 6, 0}, {65, 6, 0},
+    {65, 6, 0}, {65, 6, 0}, {65, 6, 0}, {65, 6, 0},
+    {65, 6, 0}, {65, 6, 0}, {65, 6, 0}, {65, 6, 0},
+    {65, 6, 0}, {65, 6, 0}, {65, 6, 0}, {65, 6, 0},
+    {65, 6, 0}, {65, 6, 0}, {65, 6, 0}, {65, 6, 0},
+    {65, 6, 0}, {65, 6, 0}, {65, 6, 0}, {65, 6, 0},
+    {65, 6, 0}, {65, 6, 0}, {65, 6, 0}, {65, 6, 0},
+    {68, 6, 0}, {68, 6, 0}, {68, 6, 0}, {68, 6, 0},
+    {68, 6, 0}, {68, 6, 0}, {68, 6, 0}, {68, 6, 0},
+    {68, 6, 0}, {68, 6, 0}, {68, 6, 0}, {68, 6, 0},
+    {68, 6, 0}, {68, 6, 0}, {68, 6, 0}, {68, 6, 0},
+    {68, 6, 0}, {68, 6, 0}, {68, 6, 0}, {68, 6, 0},
+    {68, 6, 0}, {68, 6, 0}, {68, 6, 0}, {68, 6, 0},
+    {68, 6, 0}, {68, 6, 0}, {68, 6, 0}, {68, 6, 0},
+    {68, 6, 0}, {68, 6, 0}, {68, 6, 0}, {68, 6, 0},
+    {131, 6, 0}, {131, 6, 0}, {131, 6, 0}, {131, 6, 0},
+    {131, 6, 0}, {131, 6, 0}, {131, 6, 0}, {131, 6, 0},
+    {131, 6, 0}, {131, 6, 0}, {131, 6, 0}, {131, 6, 0},
+    {131, 6, 0}, {131, 6, 0}, {131, 6, 0}, {131, 6, 0},
+    {131, 6, 0}, {131, 6, 0}, {131, 6, 0}, {131, 6, 0},
+    {131, 6, 0}, {131, 6, 0}, {131, 6, 0}, {131, 6, 0},
+    {131, 6, 0}, {131, 6, 0}, {131, 6, 0}, {131, 6, 0},
+    {131, 6, 0}, {131, 6, 0}, {131, 6, 0}, {131, 6, 0},
+    {139, 6, 0}, {139, 6, 0}, {139, 6, 0}, {139, 6, 0},
+    {139, 6, 0}, {139, 6, 0}, {139, 6, 0}, {139, 6, 0},
+    {139, 6, 0}, {139, 6, 0}, {139, 6, 0}, {139, 6, 0},
+    {139, 6, 0}, {139, 6, 0}, {139, 6, 0}, {139, 6, 0},
+    {139, 6, 0}, {139, 6, 0}, {139, 6, 0}, {139, 6, 0},
+    {139, 6, 0}, {139, 6, 0}, {139, 6, 0}, {139, 6, 0},
+    {139, 6, 0}, {139, 6, 0}, {139, 6, 0}, {139, 6, 0},
+    {139, 6, 0}, {139, 6, 0}, {139, 6, 0}, {139, 6, 0},
+    {2, 7, 0}, {2, 7, 0}, {2, 7, 0}, {2, 7, 0},
+    {2, 7, 0}, {2, 7, 0}, {2, 7, 0}, {2, 7, 0},
+    {2, 7, 0}, {2, 7, 0}, {2, 7, 0}, {2, 7, 0},
+    {2, 7, 0}, {2, 7, 0}, {2, 7, 0}, {2, 7, 0},
+    {4, 7, 0}, {4, 7, 0}, {4, 7, 0}, {4, 7, 0},
+    {4, 7, 0}, {4, 7, 0}, {4, 7, 0}, {4, 7, 0},
+    {4, 7, 0}, {4, 7, 0}, {4, 7, 0}, {4, 7, 0},
+    {4, 7, 0}, {4, 7, 0}, {4, 7, 0}, {4, 7, 0},
+    {14, 7, 0}, {14, 7, 0}, {14, 7, 0}, {14, 7, 0},
+    {14, 7, 0}, {14, 7, 0}, {14, 7, 0}, {14, 7, 0},
+    {14, 7, 0}, {14, 7, 0}, {14, 7, 0}, {14, 7, 0},
+    {14, 7, 0}, {14, 7, 0}, {14, 7, 0}, {14, 7, 0},
+    {16, 7, 0}, {16, 7, 0}, {16, 7, 0}, {16, 7, 0},
+    {16, 7, 0}, {16, 7, 0}, {16, 7, 0}, {16, 7, 0},
+    {16, 7, 0}, {16, 7, 0}, {16, 7, 0}, {16, 7, 0},
+    {16, 7, 0}, {16, 7, 0}, {16, 7, 0}, {16, 7, 0},
+    {69, 7, 0}, {69, 7, 0}, {69, 7, 0}, {69, 7, 0},
+    {69, 7, 0}, {69, 7, 0}, {69, 7, 0}, {69, 7, 0},
+    {69, 7, 0}, {69, 7, 0}, {69, 7, 0}, {69, 7, 0},
+    {69, 7, 0}, {69, 7, 0}, {69, 7, 0}, {69, 7, 0},
+    {73, 7, 0}, {73, 7, 0}, {73, 7, 0}, {73, 7, 0},
+    {73, 7, 0}, {73, 7, 0}, {73, 7, 0}, {73, 7, 0},
+    {73, 7, 0}, {73, 7, 0}, {73, 7, 0}, {73, 7, 0},
+    {73, 7, 0}, {73, 7, 0}, {73, 7, 0}, {73, 7, 0},
+    {76, 7, 0}, {76, 7, 0}, {76, 7, 0}, {76, 7, 0},
+    {76, 7, 0}, {76, 7, 0}, {76, 7, 0}, {76, 7, 0},
+    {76, 7, 0}, {76, 7, 0}, {76, 7, 0}, {76, 7, 0},
+    {76, 7, 0}, {76, 7, 0}, {76, 7, 0}, {76, 7, 0},
+    {102, 7, 0}, {102, 7, 0}, {102, 7, 0}, {102, 7, 0},
+    {102, 7, 0}, {102, 7, 0}, {102, 7, 0}, {102, 7, 0},
+    {102, 7, 0}, {102, 7, 0}, {102, 7, 0}, {102, 7, 0},
+    {102, 7, 0}, {102, 7, 0}, {102, 7, 0}, {102, 7, 0},
+    {116, 7, 0}, {116, 7, 0}, {116, 7, 0}, {116, 7, 0},
+    {116, 7, 0}, {116, 7, 0}, {116, 7, 0}, {116, 7, 0},
+    {116, 7, 0}, {116, 7, 0}, {116, 7, 0}, {116, 7, 0},
+    {116, 7, 0}, {116, 7, 0}, {116, 7, 0}, {116, 7, 0},
+    {132, 7, 0}, {132, 7, 0}, {132, 7, 0}, {132, 7, 0},
+    {132, 7, 0}, {132, 7, 0}, {132, 7, 0}, {132, 7, 0},
+    {132, 7, 0}, {132, 7, 0}, {132, 7, 0}, {132, 7, 0},
+    {132, 7, 0}, {132, 7, 0}, {132, 7, 0}, {132, 7, 0},
+    {133, 7, 0}, {133, 7, 0}, {133, 7, 0}, {133, 7, 0},
+    {133, 7, 0}, {133, 7, 0}, {133, 7, 0}, {133, 7, 0},
+    {133, 7, 0}, {133, 7, 0}, {133, 7, 0}, {133, 7, 0},
+    {133, 7, 0}, {133, 7, 0}, {133, 7, 0}, {133, 7, 0},
+    {141, 7, 0}, {141, 7, 0}, {141, 7, 0}, {141, 7, 0},
+    {141, 7, 0}, {141, 7, 0}, {141, 7, 0}, {141, 7, 0},
+    {141, 7, 0}, {141, 7, 0}, {141, 7, 0}, {141, 7, 0},
+    {141, 7, 0}, {141, 7, 0}, {141, 7, 0}, {141, 7, 0},
+    {192, 7, 0}, {192, 7, 0}, {192, 7, 0}, {192, 7, 0},
+    {192, 7, 0}, {192, 7, 0}, {192, 7, 0}, {192, 7, 0},
+    {192, 7, 0}, {192, 7, 0}, {192, 7, 0}, {192, 7, 0},
+    {192, 7, 0}, {192, 7, 0}, {192, 7, 0}, {192, 7, 0},
+    {233, 7, 0}, {233, 7, 0}, {233, 7, 0}, {233, 7, 0},
+    {233, 7, 0}, {233, 7, 0}, {233, 7, 0}, {233, 7, 0},
+    {233, 7, 0}, {233, 7, 0}, {233, 7, 0}, {233, 7, 0},
+    {233, 7, 0}, {233, 7, 0}, {233, 7, 0}, {233, 7, 0},
+    {3, 8, 0}, {3, 8, 0}, {3, 8, 0}, {3, 8, 0},
+    {3, 8, 0}, {3, 8, 0}, {3, 8, 0}, {3, 8, 0},
+    {5, 8, 0}, {5, 8, 0}, {5, 8, 0}, {5, 8, 0},
+    {5, 8, 0}, {5, 8, 0}, {5, 8, 0}, {5, 8, 0},
+    {7, 8, 0}, {7, 8, 0}, {7, 8, 0}, {7, 8, 0},
+    {7, 8, 0}, {7, 8, 0}, {7, 8, 0}, {7, 8, 0},
+    {9, 8, 0}, {9, 8, 0}, {9, 8, 0}, {9, 8, 0},
+    {9, 8, 0}, {9, 8, 0}, {9, 8, 0}, {9, 8, 0},
+    {10, 8, 0}, {10, 8, 0}, {10, 8, 0}, {10, 8, 0},
+    {10, 8, 0}, {10, 8, 0}, {10, 8, 0}, {10, 8, 0},
+    {11, 8, 0}, {11, 8, 0}, {11, 8, 0}, {11, 8, 0},
+    {11, 8, 0}, {11, 8, 0}, {11, 8, 0}, {11, 8, 0},
+    {12, 8, 0}, {12, 8, 0}, {12, 8, 0}, {12, 8, 0},
+    {12, 8, 0}, {12, 8, 0}, {12, 8, 0}, {12, 8, 0},
+    {17, 8, 0}, {17, 8, 0}, {17, 8, 0}, {17, 8, 0},
+    {17, 8, 0}, {17, 8, 0}, {17, 8, 0}, {17, 8, 0},
+    {20, 8, 0}, {20, 8, 0}, {20, 8, 0}, {20, 8, 0},
+    {20, 8, 0}, {20, 8, 0}, {20, 8, 0}, {20, 8, 0},
+    {23, 8, 0}, {23, 8, 0}, {23, 8, 0}, {23, 8, 0},
+    {23, 8, 0}, {23, 8, 0}, {23, 8, 0}, {23, 8, 0},
+    {24, 8, 0}, {24, 8, 0}, {24, 8, 0}, {24, 8, 0},
+    {24, 8, 0}, {24, 8, 0}, {24, 8, 0}, {24, 8, 0},
+    {31, 8, 0}, {31, 8, 0}, {31, 8, 0}, {31, 8, 0},
+    {31, 8, 0}, {31, 8, 0}, {31, 8, 0}, {31, 8, 0},
+    {32, 8, 0}, {32, 8, 0}, {32, 8, 0}, {32, 8, 0},
+    {32, 8, 0}, {32, 8, 0}, {32, 8, 0}, {32, 8, 0},
+    {40, 8, 0}, {40, 8, 0}, {40, 8, 0}, {40, 8, 0},
+    {40, 8, 0}, {40, 8, 0}, {40, 8, 0}, {40, 8, 0},
+    {41, 8, 0}, {41, 8, 0}, {41, 8, 0}, {41, 8, 0},
+    {41, 8, 0}, {41, 8, 0}, {41, 8, 0}, {41, 8, 0},
+    {48, 8, 0}, {48, 8, 0}, {48, 8, 0}, {48, 8, 0},
+    {48, 8, 0}, {48, 8, 0}, {48, 8, 0}, {48, 8, 0},
+    {49, 8, 0}, {49, 8, 0}, {49, 8, 0}, {49, 8, 0},
+    {49, 8, 0}, {49, 8, 0}, {49, 8, 0}, {49, 8, 0},
+    {56, 8, 0}, {56, 8, 0}, {56, 8, 0}, {56, 8, 0},
+    {56, 8, 0}, {56, 8, 0}, {56, 8, 0}, {56, 8, 0},
+    {57, 8, 0}, {57, 8, 0}, {57, 8, 0}, {57, 8, 0},
+    {57, 8, 0}, {57, 8, 0}, {57, 8, 0}, {57, 8, 0},
+    {64, 8, 0}, {64, 8, 0}, {64, 8, 0}, {64, 8, 0},
+    {64, 8, 0}, {64, 8, 0}, {64, 8, 0}, {64, 8, 0},
+    {66, 8, 0}, {66, 8, 0}, {66, 8, 0}, {66, 8, 0},
+    {66, 8, 0}, {66, 8, 0}, {66, 8, 0}, {66, 8, 0},
+    {71, 8, 0}, {71, 8, 0}, {71, 8, 0}, {71, 8, 0},
+    {71, 8, 0}, {71, 8, 0}, {71, 8, 0}, {71, 8, 0},
+    {77, 8, 0}, {77, 8, 0}, {77, 8, 0}, {77, 8, 0},
+    {77, 8, 0}, {77, 8, 0}, {77, 8, 0}, {77, 8, 0},
+    {84, 8, 0}, {84, 8, 0}, {84, 8, 0}, {84, 8, 0},
+    {84, 8, 0}, {84, 8, 0}, {84, 8, 0}, {84, 8, 0},
+    {92, 8, 0}, {92, 8, 0}, {92, 8, 0}, {92, 8, 0},
+    {92, 8, 0}, {92, 8, 0}, {92, 8, 0}, {92, 8, 0},
+    {101, 8, 0}, {101, 8, 0}, {101, 8, 0}, {101, 8, 0},
+    {101, 8, 0}, {101, 8, 0}, {101, 8, 0}, {101, 8, 0},
+    {114, 8, 0}, {114, 8, 0}, {114, 8, 0}, {114, 8, 0},
+    {114, 8, 0}, {114, 8, 0}, {114, 8, 0}, {114, 8, 0},
+    {117, 8, 0}, {117, 8, 0}, {117, 8, 0}, {117, 8, 0},
+    {117, 8, 0}, {117, 8, 0}, {117, 8, 0}, {117, 8, 0},
+    {136, 8, 0}, {136, 8, 0}, {136, 8, 0}, {136, 8, 0},
+    {136, 8, 0}, {136, 8, 0}, {136, 8, 0}, {136, 8, 0},
+    {182, 8, 0}, {182, 8, 0}, {182, 8, 0}, {182, 8, 0},
+    {182, 8, 0}, {182, 8, 0}, {182, 8, 0}, {182, 8, 0},
+    {183, 8, 0}, {183, 8, 0}, {183, 8, 0}, {183, 8, 0},
+    {183, 8, 0}, {183, 8, 0}, {183, 8, 0}, {183, 8, 0},
+    {193, 8, 0}, {193, 8, 0}, {193, 8, 0}, {193, 8, 0},
+    {193, 8, 0}, {193, 8, 0}, {193, 8, 0}, {193, 8, 0},
+    {195, 8, 0}, {195, 8, 0}, {195, 8, 0}, {195, 8, 0},
+    {195, 8, 0}, {195, 8, 0}, {195, 8, 0}, {195, 8, 0},
+    {199, 8, 0}, {199, 8, 0}, {199, 8, 0}, {199, 8, 0},
+    {199, 8, 0}, {199, 8, 0}, {199, 8, 0}, {199, 8, 0},
+    {208, 8, 0}, {208, 8, 0}, {208, 8, 0}, {208, 8, 0},
+    {208, 8, 0}, {208, 8, 0}, {208, 8, 0}, {208, 8, 0},
+    {211, 8, 0}, {211, 8, 0}, {211, 8, 0}, {211, 8, 0},
+    {211, 8, 0}, {211, 8, 0}, {211, 8, 0}, {211, 8, 0},
+    {232, 8, 0}, {232, 8, 0}, {232, 8, 0}, {232, 8, 0},
+    {232, 8, 0}, {232, 8, 0}, {232, 8, 0}, {232, 8, 0},
+    {246, 8, 0}, {246, 8, 0}, {246, 8, 0}, {246, 8, 0},
+    {246, 8, 0}, {246, 8, 0}, {246, 8, 0}, {246, 8, 0},
+    {248, 8, 0}, {248, 8, 0}, {248, 8, 0}, {248, 8, 0},
+    {248, 8, 0}, {248, 8, 0}, {248, 8, 0}, {248, 8, 0},
+    {254, 8, 0}, {254, 8, 0}, {254, 8, 0}, {254, 8, 0},
+    {254, 8, 0}, {254, 8, 0}, {254, 8, 0}, {254, 8, 0},
+    {6, 9, 0}, {6, 9, 0}, {6, 9, 0}, {6, 9, 0},
+    {13, 9, 0}, {13, 9, 0}, {13, 9, 0}, {13, 9, 0},
+    {18, 9, 0}, {18, 9, 0}, {18, 9, 0}, {18, 9, 0},
+    {19, 9, 0}, {19, 9, 0}, {19, 9, 0}, {19, 9, 0},
+    {21, 9, 0}, {21, 9, 0}, {21, 9, 0}, {21, 9, 0},
+    {26, 9, 0}, {26, 9, 0}, {26, 9, 0}, {26, 9, 0},
+    {27, 9, 0}, {27, 9, 0}, {27, 9, 0}, {27, 9, 0},
+    {28, 9, 0}, {28, 9, 0}, {28, 9, 0}, {28, 9, 0},
+    {46, 9, 0}, {46, 9, 0}, {46, 9, 0}, {46, 9, 0},
+    {50, 9, 0}, {50, 9, 0}, {50, 9, 0}, {50, 9, 0},
+    {51, 9, 0}, {51, 9, 0}, {51, 9, 0}, {51, 9, 0},
+    {52, 9, 0}, {52, 9, 0}, {52, 9, 0}, {52, 9, 0},
+    {60, 9, 0}, {60, 9, 0}, {60, 9, 0}, {60, 9, 0},
+    {63, 9, 0}, {63, 9, 0}, {63, 9, 0}, {63, 9, 0},
+    {67, 9, 0}, {67, 9, 0}, {67, 9, 0}, {67, 9, 0},
+    {70, 9, 0}, {70, 9, 0}, {70, 9, 0}, {70, 9, 0},
+    {75, 9, 0}, {75, 9, 0}, {75, 9, 0}, {75, 9, 0},
+    {80, 9, 0}, {80, 9, 0}, {80, 9, 0}, {80, 9, 0},
+    {83, 9, 0}, {83, 9, 0}, {83, 9, 0}, {83, 9, 0},
+    {85, 9, 0}, {85, 9, 0}, {85, 9, 0}, {85, 9, 0},
+    {86, 9, 0}, {86, 9, 0}, {86, 9, 0}, {86, 9, 0},
+    {87, 9, 0}, {87, 9, 0}, {87, 9, 0}, {87, 9, 0},
+    {91, 9, 0}, {91, 9, 0}, {91, 9, 0}, {91, 9, 0},
+    {93, 9, 0}, {93, 9, 0}, {93, 9, 0}, {93, 9, 0},
+    {95, 9, 0}, {95, 9, 0}, {95, 9, 0}, {95, 9, 0},
+    {96, 9, 0}, {96, 9, 0}, {96, 9, 0}, {96, 9, 0},
+    {97, 9, 0}, {97, 9, 0}, {97, 9, 0}, {97, 9, 0},
+    {99, 9, 0}, {99, 9, 0}, {99, 9, 0}, {99, 9, 0},
+    {100, 9, 0}, {100, 9, 0}, {100, 9, 0}, {100, 9, 0},
+    {104, 9, 0}, {104, 9, 0}, {104, 9, 0}, {104, 9, 0},
+    {105, 9, 0}, {105, 9, 0}, {105, 9, 0}, {105, 9, 0},
+    {108, 9, 0}, {108, 9, 0}, {108, 9, 0}, {108, 9, 0},
+    {110, 9, 0}, {110, 9, 0}, {110, 9, 0}, {110, 9, 0},
+    {111, 9, 0}, {111, 9, 0}, {111, 9, 0}, {111, 9, 0},
+    {112, 9, 0}, {112, 9, 0}, {112, 9, 0}, {112, 9, 0},
+    {115, 9, 0}, {115, 9, 0}, {115, 9, 0}, {115, 9, 0},
+    {119, 9, 0}, {119, 9, 0}, {119, 9, 0}, {119, 9, 0},
+    {120, 9, 0}, {120, 9, 0}, {120, 9, 0}, {120, 9, 0},
+    {123, 9, 0}, {123, 9, 0}, {123, 9, 0}, {123, 9, 0},
+    {124, 9, 0}, {124, 9, 0}, {124, 9, 0}, {124, 9, 0},
+    {125, 9, 0}, {125, 9, 0}, {125, 9, 0}, {125, 9, 0},
+    {127, 9, 0}, {127, 9, 0}, {127, 9, 0}, {127, 9, 0},
+    {128, 9, 0}, {128, 9, 0}, {128, 9, 0}, {128, 9, 0},
+    {129, 9, 0}, {129, 9, 0}, {129, 9, 0}, {129, 9, 0},
+    {134, 9, 0}, {134, 9, 0}, {134, 9, 0}, {134, 9, 0},
+    {140, 9, 0}, {140, 9, 0}, {140, 9, 0}, {140, 9, 0},
+    {144, 9, 0}, {144, 9, 0}, {144, 9, 0}, {144, 9, 0},
+    {184, 9, 0}, {184, 9, 0}, {184, 9, 0}, {184, 9, 0},
+    {186, 9, 0}, {186, 9, 0}, {186, 9, 0}, {186, 9, 0},
+    {188, 9, 0}, {188, 9, 0}, {188, 9, 0}, {188, 9, 0},
+    {194, 9, 0}, {194, 9, 0}, {194, 9, 0}, {194, 9, 0},
+    {196, 9, 0}, {196, 9, 0}, {196, 9, 0}, {196, 9, 0},
+    {197, 9, 0}, {197, 9, 0}, {197, 9, 0}, {197, 9, 0},
+    {198, 9, 0}, {198, 9, 0}, {198, 9, 0}, {198, 9, 0},
+    {200, 9, 0}, {200, 9, 0}, {200, 9, 0}, {200, 9, 0},
+    {201, 9, 0}, {201, 9, 0}, {201, 9, 0}, {201, 9, 0},
+    {209, 9, 0}, {209, 9, 0}, {209, 9, 0}, {209, 9, 0},
+    {210, 9, 0}, {210, 9, 0}, {210, 9, 0}, {210, 9, 0},
+    {214, 9, 0}, {214, 9, 0}, {214, 9, 0}, {214, 9, 0},
+    {215, 9, 0}, {215, 9, 0}, {215, 9, 0}, {215, 9, 0},
+    {223, 9, 0}, {223, 9, 0}, {223, 9, 0}, {223, 9, 0},
+    {224, 9, 0}, {224, 9, 0}, {224, 9, 0}, {224, 9, 0},
+    {226, 9, 0}, {226, 9, 0}, {226, 9, 0}, {226, 9, 0},
+    {234, 9, 0}, {234, 9, 0}, {234, 9, 0}, {234, 9, 0},
+    {235, 9, 0}, {235, 9, 0}, {235, 9, 0}, {235, 9, 0},
+    {236, 9, 0}, {236, 9, 0}, {236, 9, 0}, {236, 9, 0},
+    {237, 9, 0}, {237, 9, 0}, {237, 9, 0}, {237, 9, 0},
+    {238, 9, 0}, {238, 9, 0}, {238, 9, 0}, {238, 9, 0},
+    {239, 9, 0}, {239, 9, 0}, {239, 9, 0}, {239, 9, 0},
+    {240, 9, 0}, {240, 9, 0}, {240, 9, 0}, {240, 9, 0},
+    {241, 9, 0}, {241, 9, 0}, {241, 9, 0}, {241, 9, 0},
+    {242, 9, 0}, {242, 9, 0}, {242, 9, 0}, {242, 9, 0},
+    {243, 9, 0}, {243, 9, 0}, {243, 9, 0}, {243, 9, 0},
+    {247, 9, 0}, {247, 9, 0}, {247, 9, 0}, {247, 9, 0},
+    {249, 9, 0}, {249, 9, 0}, {249, 9, 0}, {249, 9, 0},
+    {250, 9, 0}, {250, 9, 0}, {250, 9, 0}, {250, 9, 0},
+    {251, 9, 0}, {251, 9, 0}, {251, 9, 0}, {251, 9, 0},
+    {252, 9, 0}, {252, 9, 0}, {252, 9, 0}, {252, 9, 0},
+    {253, 9, 0}, {253, 9, 0}, {253, 9, 0}, {253, 9, 0},
+    {22, 10, 0}, {22, 10, 0}, {25, 10, 0}, {25, 10, 0},
+    {29, 10, 0}, {29, 10, 0}, {33, 10, 0}, {33, 10, 0},
+    {34, 10, 0}, {34, 10, 0}, {35, 10, 0}, {35, 10, 0},
+    {37, 10, 0}, {37, 10, 0}, {42, 10, 0}, {42, 10, 0},
+    {43, 10, 0}, {43, 10, 0}, {44, 10, 0}, {44, 10, 0},
+    {45, 10, 0}, {45, 10, 0}, {53, 10, 0}, {53, 10, 0},
+    {54, 10, 0}, {54, 10, 0}, {58, 10, 0}, {58, 10, 0},
+    {59, 10, 0}, {59, 10, 0}, {61, 10, 0}, {61, 10, 0},
+    {62, 10, 0}, {62, 10, 0}, {74, 10, 0}, {74, 10, 0},
+    {78, 10, 0}, {78, 10, 0}, {79, 10, 0}, {79, 10, 0},
+    {81, 10, 0}, {81, 10, 0}, {82, 10, 0}, {82, 10, 0},
+    {88, 10, 0}, {88, 10, 0}, {90, 10, 0}, {90, 10, 0},
+    {94, 10, 0}, {94, 10, 0}, {98, 10, 0}, {98, 10, 0},
+    {103, 10, 0}, {103, 10, 0}, {106, 10, 0}, {106, 10, 0},
+    {107, 10, 0}, {107, 10, 0}, {109, 10, 0}, {109, 10, 0},
+    {113, 10, 0}, {113, 10, 0}, {118, 10, 0}, {118, 10, 0},
+    {121, 10, 0}, {121, 10, 0}, {122, 10, 0}, {122, 10, 0},
+    {126, 10, 0}, {126, 10, 0}, {130, 10, 0}, {130, 10, 0},
+    {135, 10, 0}, {135, 10, 0}, {142, 10, 0}, {142, 10, 0},
+    {143, 10, 0}, {143, 10, 0}, {147, 10, 0}, {147, 10, 0},
+    {148, 10, 0}, {148, 10, 0}, {149, 10, 0}, {149, 10, 0},
+    {151, 10, 0}, {151, 10, 0}, {152, 10, 0}, {152, 10, 0},
+    {154, 10, 0}, {154, 10, 0}, {160, 10, 0}, {160, 10, 0},
+    {163, 10, 0}, {163, 10, 0}, {165, 10, 0}, {165, 10, 0},
+    {168, 10, 0}, {168, 10, 0}, {171, 10, 0}, {171, 10, 0},
+    {172, 10, 0}, {172, 10, 0}, {174, 10, 0}, {174, 10, 0},
+    {175, 10, 0}, {175, 10, 0}, {176, 10, 0}, {176, 10, 0},
+    {177, 10, 0}, {177, 10, 0}, {179, 10, 0}, {179, 10, 0},
+    {180, 10, 0}, {180, 10, 0}, {185, 10, 0}, {185, 10, 0},
+    {187, 10, 0}, {187, 10, 0}, {189, 10, 0}, {189, 10, 0},
+    {190, 10, 0}, {190, 10, 0}, {191, 10, 0}, {191, 10, 0},
+    {202, 10, 0}, {202, 10, 0}, {203, 10, 0}, {203, 10, 0},
+    {204, 10, 0}, {204, 10, 0}, {205, 10, 0}, {205, 10, 0},
+    {206, 10, 0}, {206, 10, 0}, {207, 10, 0}, {207, 10, 0},
+    {212, 10, 0}, {212, 10, 0}, {213, 10, 0}, {213, 10, 0},
+    {216, 10, 0}, {216, 10, 0}, {217, 10, 0}, {217, 10, 0},
+    {218, 10, 0}, {218, 10, 0}, {219, 10, 0}, {219, 10, 0},
+    {220, 10, 0}, {220, 10, 0}, {221, 10, 0}, {221, 10, 0},
+    {222, 10, 0}, {222, 10, 0}, {225, 10, 0}, {225, 10, 0},
+    {227, 10, 0}, {227, 10, 0}, {228, 10, 0}, {228, 10, 0},
+    {229, 10, 0}, {229, 10, 0}, {230, 10, 0}, {230, 10, 0},
+    {231, 10, 0}, {231, 10, 0}, {244, 10, 0}, {244, 10, 0},
+    {245, 10, 0}, {245, 10, 0}, {30, 11, 0}, {38, 11, 0},
+    {39, 11, 0}, {47, 11, 0}, {55, 11, 0}, {89, 11, 0},
+    {138, 11, 0}, {145, 11, 0}, {146, 11, 0}, {150, 11, 0},
+    {153, 11, 0}, {155, 11, 0}, {156, 11, 0}, {157, 11, 0},
+    {158, 11, 0}, {159, 11, 0}, {161, 11, 0}, {162, 11, 0},
+    {164, 11, 0}, {166, 11, 0}, {167, 11, 0}, {169, 11, 0},
+    {170, 11, 0}, {173, 11, 0}, {178, 11, 0}, {181, 11, 0},
+};
+
+constexpr BuiltinTable BUILTIN_TABLES[STATIC_TABLES] = {
+    {STATIC_CODE_LENGTHS[0], STATIC_CODES[0], STATIC_DECODE_TABLE_0,
+     2244, 510490806u},
+    {STATIC_CODE_LENGTHS[1], STATIC_CODES[1], STATIC_DECODE_TABLE_1,
+     2248, 24240525u},
+    {STATIC_CODE_LENGTHS[2], STATIC_CODES[2], STATIC_DECODE_TABLE_2,
+     2048, 523357402u},
+};
@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+"""Feeds truncated, bit flipped and hand corrupted files to -d.
+
+Every truncation and every corrupted header has to fail with exit code 1 and
+a message. Flipped bits inside coded data can also decode to other bytes, as
+blocks carry no checksum, but must never crash the decoder.
+
+    tests/corrupt.py [huffman binary] [source directory]
+"""
+
+import os
+import random
+import struct
+import subprocess
+import sys
+import tempfile
+
+huffman, source_dir = sys.argv[1], sys.argv[2]
+work = tempfile.TemporaryDirectory()
+failures = []
+
+# magic, format version and original size, then per block its type, raw size
+# and payload size, as in main.cpp
+FILE_HEADER_SIZE = 9
+BLOCK_HEADER_SIZE = 9
+PAYLOAD = FILE_HEADER_SIZE + BLOCK_HEADER_SIZE
+
+
+def compress(data, *options):
+    source = os.path.join(work.name, "input")
+    with open(source, "wb") as f:
+        f.write(data)
+    target = os.path.join(work.name, "input.huff")
+    subprocess.run([huffman, "-c", *options, source, target], check=True,
+                   stdout=subprocess.DEVNULL)
+    with open(target, "rb") as f:
+        return f.read()
+
+
+def decompress(name, data, must_fail=True):
+    source = os.path.join(work.name, "corrupt.huff")
+    with open(source, "wb") as f:
+        f.write(data)
+    result = subprocess.run(
+        [huffman, "-d", source, os.path.join(work.name, "output")],
+        stdout=subprocess.DEVNULL, stderr=subprocess.PIPE)
+    if result.returncode not in (0, 1) or (
+            must_fail and (result.returncode != 1 or not result.stderr)):
+        failures.append(f"{name}: exit code {result.returncode}, "
+                        f"{result.stderr.decode(errors='replace').strip()}")
+
+
+def patch(data, offset, fmt, value):
+    data = bytearray(data)
+    struct.pack_into(fmt, data, offset, value)
+    return bytes(data)
+
+
+def read(name):
+    with open(os.path.join(source_dir, name), "rb") as f:
+        return f.read()
+
+
+text = read("corpus/text.txt")
+json = read("corpus/json.json")
+binary = read("corpus/binary.bin")
+mixed = text + binary + json
+counter = b"".join(struct.pack("<I", i * 7919) for i in range(5000))
+
+# One file per block type and table form, and split and filtered files
+files = {
+    "builtin": compress(json[:500], "-1"),
+    "canonical": compress(text[:20000], "-6"),
+    "pairs": compress(text, "--symbols=pairs"),
+    "rans": compress(json[:2000], "--coder=rans"),
+    "words": compress(text, "--coder=words"),
+    "bwt": compress(text, "--coder=bwt"),
+    "stored": compress(random.Random(0).randbytes(3000), "-6"),
+    "split": compress(mixed, "-6"),
+    "delta": compress(counter, "--filter=delta:4"),
+    "shuffle": compress(binary, "--filter=shuffle:4"),
+}
+
+for name, data in files.items():
+    # Any prefix is missing blocks or data
+    step = max(1, len(data) // 200)
+    for size in list(range(0, len(data), step)) + [len(data) - 1]:
+        decompress(f"{name} truncated to {size} bytes", data[:size])
+
+    rng = random.Random(name)
+    for _ in range(200):
+        offset = rng.randrange(len(data))
+        flipped = bytearray(data)
+        flipped[offset] ^= 1 << rng.randrange(8)
+        decompress(f"{name} with a bit flipped at {offset}", bytes(flipped),
+                   must_fail=offset < FILE_HEADER_SIZE)
+
+canonical = files["canonical"]
+cases = {
+    "no magic": b"HUFX" + canonical[4:],
+    "other format version": patch(canonical, 4, "B", 99),
+    "first format file": struct.pack("<IIII", 3, 1, 7, 0),
+    "original size beyond the blocks": patch(canonical, 5, "<I",
+                                             20001),
+    "type 0 block": patch(canonical, FILE_HEADER_SIZE, "B", 0),
+    "unknown block type": patch(canonical, FILE_HEADER_SIZE, "B", 200),
+    "raw size beyond the original": patch(canonical, FILE_HEADER_SIZE + 1,
+                                          "<I", 20001),
+    "raw size short of the data": patch(canonical, FILE_HEADER_SIZE + 1,
+                                        "<I", 100),
+    "payload beyond the file": patch(
+        canonical, FILE_HEADER_SIZE + 5, "<I",
+        len(canonical) - PAYLOAD + 1),
+    "rANS frequencies not adding up": patch(
+        files["rans"], PAYLOAD + 3, "<H",
+        struct.unpack_from("<H", files["rans"], PAYLOAD + 3)[0] + 1),
+    "rANS symbol count beyond the table": patch(files["rans"], PAYLOAD, "<H",
+                                                0xffff),
+    "BWT start row beyond the block": patch(files["bwt"], PAYLOAD, "<I",
+                                            0xffffffff),
+    "built-in table index out of range": patch(files["builtin"],
+                                               PAYLOAD + 1, "B", 3),
+    "built-in table id mismatch": patch(
+        files["builtin"], PAYLOAD + 2, "<I",
+        struct.unpack_from("<I", files["builtin"], PAYLOAD + 2)[0] ^ 1),
+    "unknown table form": patch(files["canonical"], PAYLOAD, "B", 0x70),
+    "vocabulary larger than the block": patch(files["words"], PAYLOAD, "<I",
+                                              0xffffffff),
+}
+for name, data in cases.items():
+    decompress(name, data)
+
+for failure in failures:
+    print("FAIL:", failure)
+sys.exit(1 if failures else 0)
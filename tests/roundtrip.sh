@@ -0,0 +1,67 @@
+#!/bin/sh
+# Compresses and decompresses every input and checks that the output matches
+# the input and that --estimate predicts the compressed size exactly
+#
+#   tests/roundtrip.sh [huffman binary] [source directory]
+
+huffman=$1
+source_dir=$2
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+# The sources and the corpus, edge cases, and a file of a few MiB that mixes
+# them with runs, so that it gets several blocks
+: >"$work/empty"
+printf 'a' >"$work/one"
+head -c 70000 /dev/zero >"$work/zeros"
+for part in 1 2 3 4 5 6; do
+  cat "$source_dir/main.cpp" "$source_dir/corpus/json.json"
+  head -c 20000 /dev/zero
+  cat "$source_dir/corpus/binary.bin" "$source_dir/corpus/text.txt"
+done >"$work/mixed"
+inputs="$source_dir/main.cpp $source_dir/README.md $source_dir/corpus/text.txt
+        $source_dir/corpus/json.json $source_dir/corpus/binary.bin
+        $work/empty $work/one $work/zeros $work/mixed"
+
+failures=0
+run() {
+  for input in $inputs; do
+    name=$(basename "$input")
+    if ! "$huffman" -c "$@" "$input" "$work/out.huff" >/dev/null ||
+      ! "$huffman" -d "$@" "$work/out.huff" "$work/out" >/dev/null ||
+      ! cmp -s "$input" "$work/out"; then
+      echo "FAIL: $* $name does not round trip"
+      failures=$((failures + 1))
+      continue
+    fi
+
+    size=$(wc -c <"$work/out.huff" | tr -d ' ')
+    estimate=$("$huffman" --estimate "$@" "$input" |
+      sed -n 's/.* -> \([0-9]*\) bytes.*/\1/p')
+    if [ "$estimate" != "$size" ]; then
+      echo "FAIL: $* $name estimated $estimate bytes, compressed to $size"
+      failures=$((failures + 1))
+    fi
+  done
+}
+
+for level in 1 2 3 4 5 6 7 8 9; do
+  run "-$level"
+done
+for coder in huffman rans auto words bwt; do
+  run "--coder=$coder"
+done
+for symbols in 8 16 pairs; do
+  run "--symbols=$symbols"
+done
+for filter in delta:1 delta:2 delta:4 delta:8 shuffle:2 shuffle:3 shuffle:4 \
+  shuffle:8 shuffle:16; do
+  run "--filter=$filter"
+done
+run --threads=1 --io=pread
+run -9 --threads=4 --memory-limit=20M
+
+if [ "$failures" -ne 0 ]; then
+  echo "$failures round trips failed"
+  exit 1
+fi
@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""Talks to --serve over its Unix socket.
+
+Round trips the corpus inline and through file descriptors on one
+connection, checks that corrupt input only fails its request, and that
+inline input over the memory limit is refused and ends the connection.
+
+    tests/serve.py [huffman binary] [source directory]
+"""
+
+import os
+import socket
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+
+huffman, source_dir = sys.argv[1], sys.argv[2]
+work = tempfile.TemporaryDirectory()
+path = os.path.join(work.name, "socket")
+failures = []
+
+# Operations, status bytes and the request header as in main.cpp
+COMPRESS, DECOMPRESS, FDS = 0, 1, 0x80
+OK, FAILED = 0, 1
+MEMORY_LIMIT = 64 << 20
+
+
+def receive(connection, size):
+    data = b""
+    while len(data) < size:
+        chunk = connection.recv(size - len(data))
+        if not chunk:
+            return None
+        data += chunk
+    return data
+
+
+def request(connection, operation, data, level=0, size=None, fds=()):
+    header = struct.pack("<BBQ", operation, level,
+                         len(data) if size is None else size)
+    if fds:
+        socket.send_fds(connection, [header], list(fds))
+    else:
+        connection.sendall(header)
+    if data:
+        connection.sendall(data)
+    response = receive(connection, 9)
+    if response is None:
+        return None, None
+    status, size = struct.unpack("<BQ", response)
+    return status, receive(connection, size) if not fds or status else size
+
+
+def check(condition, message):
+    if not condition:
+        failures.append(message)
+
+
+server = subprocess.Popen([huffman, "--serve", "--threads=2",
+                           f"--memory-limit={MEMORY_LIMIT >> 20}M", path])
+try:
+    for _ in range(100):
+        if os.path.exists(path):
+            break
+        time.sleep(0.05)
+
+    connection = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+    connection.connect(path)
+
+    for name in ["corpus/text.txt", "corpus/json.json", "corpus/binary.bin",
+                 "main.cpp"]:
+        with open(os.path.join(source_dir, name), "rb") as f:
+            data = f.read()
+        for level in [0, 1, 6, 9]:
+            status, compressed = request(connection, COMPRESS, data, level)
+            check(status == OK, f"{name} -{level} was not compressed")
+            status, restored = request(connection, DECOMPRESS, compressed)
+            check(status == OK and restored == data,
+                  f"{name} -{level} does not round trip")
+
+        # The same through memfds, the output is cut to its size
+        source = os.memfd_create("input")
+        target = os.memfd_create("output")
+        os.write(source, data)
+        status, size = request(connection, COMPRESS | FDS, b"",
+                               fds=[source, target])
+        check(status == OK and os.fstat(target).st_size == size,
+              f"{name} was not compressed to a file descriptor")
+        restored_fd = os.memfd_create("restored")
+        status, size = request(connection, DECOMPRESS | FDS, b"",
+                               fds=[target, restored_fd])
+        check(status == OK and size == len(data) and
+              os.pread(restored_fd, size, 0) == data,
+              f"{name} does not round trip through file descriptors")
+        for fd in [source, target, restored_fd]:
+            os.close(fd)
+
+    # Corrupt and unknown requests fail alone
+    status, message = request(connection, DECOMPRESS, compressed[:-10])
+    check(status == FAILED and message, "corrupt input did not fail")
+    status, message = request(connection, 5, b"abc")
+    check(status == FAILED and message, "an unknown operation did not fail")
+    status, _ = request(connection, COMPRESS, b"still in step")
+    check(status == OK, "the connection did not survive failed requests")
+
+    # Inline input over the limit is refused before it is read, and the
+    # connection is closed as the rest of the request cannot be skipped
+    for size in [MEMORY_LIMIT + 1, 2**64 - 1]:
+        connection = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        connection.connect(path)
+        status, message = request(connection, COMPRESS, b"", size=size)
+        check(status == FAILED and b"larger than" in message,
+              f"{size} bytes of inline input were not refused")
+        check(receive(connection, 1) is None,
+              f"the connection stayed open after refusing {size} bytes")
+        connection.close()
+
+    check(server.poll() is None, "the server exited")
+finally:
+    server.kill()
+    server.wait()
+
+for failure in failures:
+    print("FAIL:", failure)
+sys.exit(1 if failures else 0)